@@ -0,0 +1,11 @@
+set(FETCHCONTENT_QUIET FALSE)
+include(FetchContent)
+
+# nanobench
+# ---------
+FetchContent_Declare(
+  nanobench
+  URL https://github.com/martinus/nanobench/archive/refs/tags/v4.3.11.tar.gz
+  DOWNLOAD_EXTRACT_TIMESTAMP ON
+)
+FetchContent_MakeAvailable(nanobench)
@@ -0,0 +1,310 @@
+#include <sync_cpp/sync.hpp>
+#include <sync_cpp/group.hpp>
+#include <sync_cpp/mutex/big_reader_mutex.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <latch>
+#include <limits>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+// Contention scaling sweep: runs a configurable mix of read, write and Group operations on Sync objects from
+// a varying number of threads, for every mutex type, read ratio and critical section length, and reports
+// throughput and latency percentiles as CSV (one row per configuration) on stdout.
+//
+// usage: sync-cpp-sweep [options]
+//   --mutex    <list>   mutex types: mutex,shared_mutex,recursive_mutex,big_reader  (default: all)
+//   --threads  <list>   thread counts                                   (default: 1,2,4,.. up to #cores)
+//   --read     <list>   percentage of read operations                  (default: 0,50,90,99)
+//   --group    <list>   percentage of Group (two objects) writes       (default: 0)
+//   --cs       <list>   critical section length in work units          (default: 0,16,256)
+//   --think    <n>      work units done outside the lock between ops   (default: 0)
+//   --duration <ms>     duration of each configuration                 (default: 200)
+//   --sample   <n>      record the latency of every n-th operation     (default: 8)
+//
+// <list> is a comma separated list of values, e.g. --threads 1,2,4,8
+
+using Clock = std::chrono::steady_clock;
+
+struct State
+{
+    std::array<std::uint64_t, 8> m_data{};
+
+    std::uint64_t work(std::size_t units) const noexcept
+    {
+        auto sum = std::uint64_t{ 0 };
+        for (auto i = 0u; i < units; ++i) {
+            sum += m_data[i % m_data.size()] ^ i;
+        }
+        return sum;
+    }
+
+    void mutate(std::size_t units) noexcept
+    {
+        m_data[0] += 1;
+        for (auto i = 0u; i < units; ++i) {
+            m_data[i % m_data.size()] += i;
+        }
+    }
+};
+
+struct Config
+{
+    std::vector<std::string> m_mutexes   = { "mutex", "shared_mutex", "recursive_mutex", "big_reader" };
+    std::vector<std::size_t> m_threads   = {};
+    std::vector<std::size_t> m_read_pct  = { 0, 50, 90, 99 };
+    std::vector<std::size_t> m_group_pct = { 0 };
+    std::vector<std::size_t> m_cs        = { 0, 16, 256 };
+    std::size_t              m_think     = 0;
+    std::size_t              m_duration  = 200;
+    std::size_t              m_sample    = 8;
+};
+
+struct Point
+{
+    std::size_t m_threads;
+    std::size_t m_read_pct;
+    std::size_t m_group_pct;
+    std::size_t m_cs;
+};
+
+struct ThreadResult
+{
+    std::uint64_t              m_ops = 0;
+    std::vector<std::uint32_t> m_latencies;
+};
+
+// xorshift, good enough to pick the operation kind
+class Random
+{
+public:
+    explicit Random(std::uint64_t seed)
+        : m_state{ seed * 0x9E37'79B9'7F4A'7C15 + 1 }
+    {
+    }
+
+    std::size_t percent()
+    {
+        m_state ^= m_state << 13;
+        m_state ^= m_state >> 7;
+        m_state ^= m_state << 17;
+        return m_state % 100;
+    }
+
+private:
+    std::uint64_t m_state;
+};
+
+std::uint32_t percentile(const std::vector<std::uint32_t>& sorted, double p)
+{
+    if (sorted.empty()) {
+        return 0;
+    }
+    auto index = static_cast<std::size_t>(p * static_cast<double>(sorted.size() - 1));
+    return sorted[index];
+}
+
+template <typename M>
+void run_point(std::string_view name, const Config& config, const Point& point)
+{
+    auto sync_a = spp::Sync<State, M>{};
+    auto sync_b = spp::Sync<State, M>{};
+
+    auto stop    = std::atomic<bool>{ false };
+    auto ready   = std::latch{ static_cast<std::ptrdiff_t>(point.m_threads + 1) };
+    auto results = std::vector<ThreadResult>(point.m_threads);
+    auto sink    = std::atomic<std::uint64_t>{ 0 };
+
+    auto worker = [&](std::size_t id) {
+        auto& result = results[id];
+        auto  random = Random{ id + 1 };
+        auto  local  = State{};
+        auto  acc    = std::uint64_t{ 0 };
+
+        result.m_latencies.reserve(1 << 16);
+        ready.arrive_and_wait();
+
+        while (not stop.load(std::memory_order_relaxed)) {
+            auto sampled = result.m_ops % config.m_sample == 0;
+            auto start   = sampled ? Clock::now() : Clock::time_point{};
+
+            auto dice = random.percent();
+            if (dice < point.m_read_pct) {
+                acc += sync_a.read([&](const State& s) { return s.work(point.m_cs); });
+            } else if (dice < point.m_read_pct + point.m_group_pct) {
+                spp::group(sync_a, sync_b).write([&](State& a, State& b) {
+                    a.mutate(point.m_cs / 2);
+                    b.mutate(point.m_cs / 2);
+                });
+            } else {
+                sync_a.write([&](State& s) { s.mutate(point.m_cs); });
+            }
+
+            if (sampled) {
+                auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start);
+                result.m_latencies.push_back(static_cast<std::uint32_t>(
+                    std::min<std::int64_t>(elapsed.count(), std::numeric_limits<std::uint32_t>::max())
+                ));
+            }
+
+            acc += local.work(config.m_think);
+            ++result.m_ops;
+        }
+
+        sink.fetch_add(acc, std::memory_order_relaxed);
+    };
+
+    auto threads = std::vector<std::jthread>{};
+    for (auto i = 0u; i < point.m_threads; ++i) {
+        threads.emplace_back(worker, i);
+    }
+
+    ready.arrive_and_wait();
+    auto start = Clock::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds{ config.m_duration });
+    stop.store(true, std::memory_order_relaxed);
+    threads.clear();
+    auto seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    auto ops       = std::uint64_t{ 0 };
+    auto latencies = std::vector<std::uint32_t>{};
+    for (auto& result : results) {
+        ops += result.m_ops;
+        latencies.insert(latencies.end(), result.m_latencies.begin(), result.m_latencies.end());
+    }
+    std::sort(latencies.begin(), latencies.end());
+
+    std::cout << name << ',' << point.m_threads << ',' << point.m_read_pct << ',' << point.m_group_pct << ','
+              << point.m_cs << ',' << config.m_think << ',' << ops << ',' << seconds << ','
+              << static_cast<std::uint64_t>(static_cast<double>(ops) / seconds) << ','
+              << percentile(latencies, 0.50) << ',' << percentile(latencies, 0.99) << ','
+              << percentile(latencies, 0.999) << '\n';
+}
+
+template <typename M>
+void sweep(std::string_view name, const Config& config)
+{
+    for (auto cs : config.m_cs) {
+        for (auto group_pct : config.m_group_pct) {
+            for (auto read_pct : config.m_read_pct) {
+                if (read_pct + group_pct > 100) {
+                    continue;
+                }
+                for (auto threads : config.m_threads) {
+                    run_point<M>(name, config, { threads, read_pct, group_pct, cs });
+                }
+            }
+        }
+    }
+}
+
+bool parse_number(std::string_view str, std::size_t& out)
+{
+    auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), out);
+    return ec == std::errc{} and ptr == str.data() + str.size();
+}
+
+template <typename T>
+bool parse_list(std::string_view str, std::vector<T>& out)
+{
+    out.clear();
+    while (not str.empty()) {
+        auto comma = str.find(',');
+        auto item  = str.substr(0, comma);
+        if constexpr (std::same_as<T, std::string>) {
+            out.emplace_back(item);
+        } else {
+            if (auto value = std::size_t{}; parse_number(item, value)) {
+                out.push_back(value);
+            } else {
+                return false;
+            }
+        }
+        str = comma == std::string_view::npos ? std::string_view{} : str.substr(comma + 1);
+    }
+    return not out.empty();
+}
+
+bool parse_args(int argc, char** argv, Config& config)
+{
+    for (auto i = 1; i < argc; ++i) {
+        auto arg = std::string_view{ argv[i] };
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for '" << arg << "'\n";
+            return false;
+        }
+        auto value = std::string_view{ argv[++i] };
+
+        auto ok = false;
+        if (arg == "--mutex") {
+            ok = parse_list(value, config.m_mutexes);
+        } else if (arg == "--threads") {
+            ok = parse_list(value, config.m_threads);
+        } else if (arg == "--read") {
+            ok = parse_list(value, config.m_read_pct);
+        } else if (arg == "--group") {
+            ok = parse_list(value, config.m_group_pct);
+        } else if (arg == "--cs") {
+            ok = parse_list(value, config.m_cs);
+        } else if (arg == "--think") {
+            ok = parse_number(value, config.m_think);
+        } else if (arg == "--duration") {
+            ok = parse_number(value, config.m_duration);
+        } else if (arg == "--sample") {
+            ok = parse_number(value, config.m_sample) and config.m_sample > 0;
+        } else {
+            std::cerr << "Unknown option '" << arg << "'\n";
+            return false;
+        }
+
+        if (not ok) {
+            std::cerr << "Invalid value '" << value << "' for '" << arg << "'\n";
+            return false;
+        }
+    }
+
+    if (config.m_threads.empty()) {
+        auto cores = std::max(std::thread::hardware_concurrency(), 1u);
+        for (auto n = 1u; n < cores; n *= 2) {
+            config.m_threads.push_back(n);
+        }
+        config.m_threads.push_back(cores);
+    }
+
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    auto config = Config{};
+    if (not parse_args(argc, argv, config)) {
+        return 1;
+    }
+
+    std::cout << "mutex,threads,read_pct,group_pct,cs,think,ops,seconds,throughput,p50_ns,p99_ns,p999_ns\n";
+
+    for (const auto& mutex : config.m_mutexes) {
+        if (mutex == "mutex") {
+            sweep<std::mutex>(mutex, config);
+        } else if (mutex == "shared_mutex") {
+            sweep<std::shared_mutex>(mutex, config);
+        } else if (mutex == "recursive_mutex") {
+            sweep<std::recursive_mutex>(mutex, config);
+        } else if (mutex == "big_reader") {
+            sweep<spp::BigReaderMutex<>>(mutex, config);
+        } else {
+            std::cerr << "Unknown mutex type '" << mutex << "'\n";
+            return 1;
+        }
+    }
+}
@@ -0,0 +1,267 @@
+#include <sync_cpp/sync.hpp>
+#include <sync_cpp/sync_container.hpp>
+#include <sync_cpp/sync_opt.hpp>
+#include <sync_cpp/sync_smart_ptr.hpp>
+#include <sync_cpp/group.hpp>
+
+#include <nanobench.h>
+
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Measures the per-call overhead of every access path of the Sync wrappers on an uncontended mutex against a
+// hand-written mutex + lock_guard baseline doing the exact same work.
+//
+// usage: sync-cpp-bench [output.json]
+//
+// The human readable table is written to stderr, the JSON report (one entry per comparison) is written to
+// the given file or to stdout if no file is given.
+
+namespace nb = ankerl::nanobench;
+
+struct Counter
+{
+    int m_value = 0;
+
+    int  get() const noexcept { return m_value; }
+    int  add(int v) noexcept { return m_value += v; }
+    auto operator<=>(const Counter&) const = default;
+};
+
+struct Getter
+{
+    decltype(auto) operator()(auto&& opt) const { return *opt; }
+};
+
+using SyncCounter       = spp::Sync<Counter>;
+using SyncSharedCounter = spp::Sync<Counter, std::shared_mutex>;
+using SyncContainerOpt  = spp::SyncContainer<std::optional<Counter>, Counter, Getter>;
+using SyncOptChecked    = spp::SyncOpt<Counter, std::mutex, true>;
+using SyncOptUnchecked  = spp::SyncOpt<Counter, std::mutex, false>;
+using SyncPtrChecked    = spp::SyncUnique<Counter, std::mutex, true>;
+using SyncPtrUnchecked  = spp::SyncUnique<Counter, std::mutex, false>;
+
+nb::Bench make_bench(std::string_view title)
+{
+    auto bench = nb::Bench{};
+    bench.title(std::string{ title })
+        .unit("op")
+        .warmup(1'000)
+        .minEpochIterations(100'000)
+        .relative(true)
+        .performanceCounters(true)
+        .output(&std::cerr);
+    return bench;
+}
+
+nb::Bench bench_get()
+{
+    auto bench = make_bench("Sync::get");
+
+    auto mutex   = std::mutex{};
+    auto counter = Counter{ 42 };
+    bench.run("baseline: lock_guard + member", [&] {
+        auto lock = std::lock_guard{ mutex };
+        nb::doNotOptimizeAway(counter.m_value);
+    });
+
+    auto sync = SyncCounter{ 42 };
+    bench.run("Sync::get", [&] { nb::doNotOptimizeAway(sync.get(&Counter::m_value)); });
+
+    return bench;
+}
+
+nb::Bench bench_member_function()
+{
+    auto bench = make_bench("Sync::read/write (member function pointer)");
+
+    auto mutex   = std::mutex{};
+    auto counter = Counter{ 42 };
+    bench.run("baseline: lock_guard + const call", [&] {
+        auto lock = std::lock_guard{ mutex };
+        nb::doNotOptimizeAway(counter.get());
+    });
+    bench.run("baseline: lock_guard + mutating call", [&] {
+        auto lock = std::lock_guard{ mutex };
+        nb::doNotOptimizeAway(counter.add(1));
+    });
+
+    auto sync = SyncCounter{ 42 };
+    bench.run("Sync::read(&T::fn)", [&] { nb::doNotOptimizeAway(sync.read(&Counter::get)); });
+    bench.run("Sync::write(&T::fn, args...)", [&] { nb::doNotOptimizeAway(sync.write(&Counter::add, 1)); });
+
+    return bench;
+}
+
+nb::Bench bench_lambda()
+{
+    auto bench = make_bench("Sync::read/write (lambda)");
+
+    auto mutex   = std::mutex{};
+    auto counter = Counter{ 42 };
+    bench.run("baseline: lock_guard + read", [&] {
+        auto lock = std::lock_guard{ mutex };
+        nb::doNotOptimizeAway(counter.m_value);
+    });
+    bench.run("baseline: lock_guard + write", [&] {
+        auto lock = std::lock_guard{ mutex };
+        nb::doNotOptimizeAway(++counter.m_value);
+    });
+
+    auto sync = SyncCounter{ 42 };
+    bench.run("Sync::read(fn)", [&] {
+        nb::doNotOptimizeAway(sync.read([](const Counter& c) { return c.m_value; }));
+    });
+    bench.run("Sync::write(fn)", [&] {
+        nb::doNotOptimizeAway(sync.write([](Counter& c) { return ++c.m_value; }));
+    });
+
+    auto shared_mutex = std::shared_mutex{};
+    bench.run("baseline: shared_lock + read", [&] {
+        auto lock = std::shared_lock{ shared_mutex };
+        nb::doNotOptimizeAway(counter.m_value);
+    });
+
+    auto shared_sync = SyncSharedCounter{ 42 };
+    bench.run("Sync<T, std::shared_mutex>::read(fn)", [&] {
+        nb::doNotOptimizeAway(shared_sync.read([](const Counter& c) { return c.m_value; }));
+    });
+
+    return bench;
+}
+
+nb::Bench bench_container()
+{
+    auto bench = make_bench("SyncContainer/SyncOpt::read_value");
+
+    auto mutex = std::mutex{};
+    auto opt   = std::optional<Counter>{ 42 };
+    bench.run("baseline: lock_guard + *opt", [&] {
+        auto lock = std::lock_guard{ mutex };
+        nb::doNotOptimizeAway(opt->get());
+    });
+    bench.run("baseline: lock_guard + opt.value()", [&] {
+        auto lock = std::lock_guard{ mutex };
+        nb::doNotOptimizeAway(opt.value().get());
+    });
+
+    auto container = SyncContainerOpt{ Counter{ 42 } };
+    bench.run("SyncContainer::read_value(&T::fn)", [&] {
+        nb::doNotOptimizeAway(container.read_value(&Counter::get));
+    });
+    bench.run("SyncContainer::read_value(fn)", [&] {
+        nb::doNotOptimizeAway(container.read_value([](const Counter& c) { return c.m_value; }));
+    });
+
+    auto unchecked = SyncOptUnchecked{ 42 };
+    bench.run("SyncOpt<unchecked>::read_value(&T::fn)", [&] {
+        nb::doNotOptimizeAway(unchecked.read_value(&Counter::get));
+    });
+
+    auto checked = SyncOptChecked{ 42 };
+    bench.run("SyncOpt<checked>::read_value(&T::fn)", [&] {
+        nb::doNotOptimizeAway(checked.read_value(&Counter::get));
+    });
+
+    return bench;
+}
+
+nb::Bench bench_smart_ptr()
+{
+    auto bench = make_bench("SyncSmartPtr::read_value");
+
+    auto mutex = std::mutex{};
+    auto ptr   = std::make_unique<Counter>(42);
+    bench.run("baseline: lock_guard + *ptr", [&] {
+        auto lock = std::lock_guard{ mutex };
+        nb::doNotOptimizeAway(ptr->get());
+    });
+    bench.run("baseline: lock_guard + null check + *ptr", [&] {
+        auto lock = std::lock_guard{ mutex };
+        nb::doNotOptimizeAway(ptr ? ptr->get() : throw std::runtime_error{ "null" });
+    });
+
+    auto unchecked = SyncPtrUnchecked{ std::make_unique<Counter>(42) };
+    bench.run("SyncSmartPtr<unchecked>::read_value(&T::fn)", [&] {
+        nb::doNotOptimizeAway(unchecked.read_value(&Counter::get));
+    });
+
+    auto checked = SyncPtrChecked{ std::make_unique<Counter>(42) };
+    bench.run("SyncSmartPtr<checked>::read_value(&T::fn)", [&] {
+        nb::doNotOptimizeAway(checked.read_value(&Counter::get));
+    });
+
+    return bench;
+}
+
+nb::Bench bench_group()
+{
+    auto bench = make_bench("Group::read/write");
+
+    auto mutex_a   = std::mutex{};
+    auto mutex_b   = std::mutex{};
+    auto counter_a = Counter{ 1 };
+    auto counter_b = Counter{ 2 };
+    bench.run("baseline: two lock_guard + read", [&] {
+        auto lock_a = std::lock_guard{ mutex_a };
+        auto lock_b = std::lock_guard{ mutex_b };
+        nb::doNotOptimizeAway(counter_a.m_value + counter_b.m_value);
+    });
+    bench.run("baseline: two lock_guard + write", [&] {
+        auto lock_a = std::lock_guard{ mutex_a };
+        auto lock_b = std::lock_guard{ mutex_b };
+        nb::doNotOptimizeAway(++counter_a.m_value + ++counter_b.m_value);
+    });
+
+    auto sync_a = SyncCounter{ 1 };
+    auto sync_b = SyncCounter{ 2 };
+    bench.run("Group::read(fn)", [&] {
+        nb::doNotOptimizeAway(spp::group(sync_a, sync_b).read([](const Counter& a, const Counter& b) {
+            return a.m_value + b.m_value;
+        }));
+    });
+    bench.run("Group::write(fn)", [&] {
+        nb::doNotOptimizeAway(spp::group(sync_a, sync_b).write([](Counter& a, Counter& b) {
+            return ++a.m_value + ++b.m_value;
+        }));
+    });
+
+    return bench;
+}
+
+int main(int argc, char** argv)
+{
+    auto benches = std::vector<nb::Bench>{};
+
+    benches.push_back(bench_get());
+    benches.push_back(bench_member_function());
+    benches.push_back(bench_lambda());
+    benches.push_back(bench_container());
+    benches.push_back(bench_smart_ptr());
+    benches.push_back(bench_group());
+
+    auto file = std::ofstream{};
+    if (argc > 1) {
+        file.open(argv[1]);
+        if (not file) {
+            std::cerr << "Failed to open '" << argv[1] << "' for writing\n";
+            return 1;
+        }
+    }
+    auto& out = argc > 1 ? static_cast<std::ostream&>(file) : std::cout;
+
+    out << "[\n";
+    for (auto i = 0u; i < benches.size(); ++i) {
+        nb::render(nb::templates::json(), benches[i], out);
+        out << (i + 1 < benches.size() ? ",\n" : "\n");
+    }
+    out << "]\n";
+}
@@ -1,6 +1,7 @@
 #ifndef SYNC_CPP_CONCEPTS_HPP_RG36TC7P
 #define SYNC_CPP_CONCEPTS_HPP_RG36TC7P
 
+#include <chrono>
 #include <concepts>
 #include <mutex>
 #include <shared_mutex>
@@ -25,16 +26,121 @@ namespace spp::concepts
     template <typename T>
     concept Syncable = std::is_class_v<T> and not std::is_reference_v<T> and not std::is_const_v<T>;
 
+    /**
+     * @brief The requirements for type to be synchronized with a seqlock (used in SyncSeqlock).
+     */
+    template <typename T>
+    concept SeqlockSyncable = Syncable<T> and std::is_trivially_copyable_v<T>;
+
+    /**
+     * @brief The named requirements Lockable: lock(), unlock() and try_lock().
+     */
+    template <typename T>
+    concept Lockable = requires (T& mutex) {
+        mutex.lock();
+        mutex.unlock();
+        { mutex.try_lock() } -> std::convertible_to<bool>;
+    };
+
+    /**
+     * @brief The named requirements SharedLockable: lock_shared(), unlock_shared() and try_lock_shared().
+     */
+    template <typename T>
+    concept SharedLockable = requires (T& mutex) {
+        mutex.lock_shared();
+        mutex.unlock_shared();
+        { mutex.try_lock_shared() } -> std::convertible_to<bool>;
+    };
+
+    /**
+     * @brief The named requirements TimedLockable: Lockable plus try_lock_for() and try_lock_until().
+     */
+    template <typename T>
+    concept TimedLockable = Lockable<T> and requires (T& mutex) {
+        { mutex.try_lock_for(std::chrono::milliseconds{}) } -> std::convertible_to<bool>;
+        { mutex.try_lock_until(std::chrono::steady_clock::now()) } -> std::convertible_to<bool>;
+    };
+
+    /**
+     * @brief The named requirements SharedTimedLockable: try_lock_shared_for() and try_lock_shared_until().
+     */
+    template <typename T>
+    concept SharedTimedLockable = SharedLockable<T> and requires (T& mutex) {
+        { mutex.try_lock_shared_for(std::chrono::milliseconds{}) } -> std::convertible_to<bool>;
+        { mutex.try_lock_shared_until(std::chrono::steady_clock::now()) } -> std::convertible_to<bool>;
+    };
+
+    /**
+     * @brief An upgradeable shared mutex: the upgrade lock is shared with readers but not with another
+     * upgrade or exclusive lock, and turns into the exclusive lock atomically (see spp::ParkingUpgradeMutex).
+     */
+    template <typename T>
+    concept UpgradeLockable = SharedLockable<T> and requires (T& mutex) {
+        mutex.lock_upgrade();
+        { mutex.try_lock_upgrade() } -> std::convertible_to<bool>;
+        mutex.unlock_upgrade();
+        mutex.unlock_upgrade_and_lock();
+    };
+
+    /**
+     * @brief A shared mutex whose exclusive lock turns into a shared lock atomically.
+     */
+    template <typename T>
+    concept DowngradableLockable = SharedLockable<T> and requires (T& mutex) {
+        mutex.unlock_and_lock_shared();
+    };
+
+    /**
+     * @brief A shared mutex for coroutines: `co_await mutex.lock_async()` (or `lock_shared_async()`) resumes
+     * the coroutine once the lock is held (see spp::AsyncSharedMutex).
+     */
+    template <typename T>
+    concept AsyncSharedLockable = requires (T& mutex) {
+        mutex.lock_async();
+        mutex.lock_shared_async();
+        mutex.unlock();
+        mutex.unlock_shared();
+        { mutex.try_lock() } -> std::convertible_to<bool>;
+        { mutex.try_lock_shared() } -> std::convertible_to<bool>;
+    };
+
+    /**
+     * @brief A table of mutexes shared by objects according to their address (see spp::Striped).
+     */
+    template <typename T>
+    concept StripedMutex = requires (const void* address) {
+        typename T::Mutex;
+        requires Lockable<typename T::Mutex>;
+
+        { T::stripe_for(address) } -> std::same_as<typename T::Mutex&>;
+    };
+
+    /**
+     * @brief The requirements for a mutex to be used in Sync derivatives.
+     *
+     * Any Lockable type will do, if it is also SharedLockable read access will take a shared lock. A
+     * StripedMutex makes Sync hold no mutex at all and lock the stripe its address maps to instead.
+     */
     template <typename T>
     concept SyncMutex = requires {
         requires not std::is_reference_v<T>;
         requires not std::is_const_v<T>;
 
-        requires std::derived_from<T, std::mutex>                  //
-                     or std::derived_from<T, std::shared_mutex>    //
-                     or std::derived_from<T, std::recursive_mutex>;
+        requires Lockable<T> or StripedMutex<T>;
     };
 
+    /**
+     * @brief A backoff policy for spinning waits: default constructible, called once per failed attempt.
+     */
+    template <typename T>
+    concept Backoff = std::default_initializable<T> and std::invocable<T&>;
+
+    /**
+     * @brief A mutex that reports a snapshot of its acquisition statistics (see spp::InstrumentedMutex).
+     */
+    template <typename T>
+    concept InstrumentedLockable = Lockable<T> and requires (const T& mutex) { mutex.stats(); };
+
     /**
      * @brief The requirements for a type to be considered a Sync derivative.
      */
@@ -0,0 +1,95 @@
+#ifndef SYNC_CPP_DETAIL_ACQUIRE_HPP_Z8CM4HTA
+#define SYNC_CPP_DETAIL_ACQUIRE_HPP_Z8CM4HTA
+
+#include "sync_cpp/concepts.hpp"
+#include "sync_cpp/mutex/backoff.hpp"
+
+#include <chrono>
+#include <mutex>
+#include <shared_mutex>
+#include <stop_token>
+
+namespace spp::detail
+{
+    // whether the (deferred) standard lock can wait on its mutex with a timeout
+    template <typename Lock>
+    inline constexpr bool timed_lock = false;
+
+    template <typename M>
+    inline constexpr bool timed_lock<std::unique_lock<M>> = concepts::TimedLockable<M>;
+
+    template <typename M>
+    inline constexpr bool timed_lock<std::shared_lock<M>> = concepts::SharedTimedLockable<M>;
+
+    // how often a blocked wait checks for a stop request when the mutex supports timed waits
+    inline constexpr auto stop_poll_interval = std::chrono::milliseconds{ 1 };
+
+    /**
+     * @brief Acquire a deferred std::unique_lock or std::shared_lock before a deadline.
+     *
+     * Timed mutexes wait on the mutex itself, others are polled with backoff.
+     *
+     * @return Whether the lock was acquired.
+     */
+    template <typename Lock, typename Clock, typename Duration>
+    bool acquire(Lock& lock, const std::chrono::time_point<Clock, Duration>& deadline)
+    {
+        if constexpr (timed_lock<Lock>) {
+            return lock.try_lock_until(deadline);
+        } else {
+            auto backoff = backoff::SpinThenSleep<>{};
+            while (not lock.try_lock()) {
+                if (Clock::now() >= deadline) {
+                    return false;
+                }
+                backoff();
+            }
+            return true;
+        }
+    }
+
+    /**
+     * @brief Acquire a deferred std::unique_lock or std::shared_lock unless a stop is requested.
+     *
+     * Timed mutexes wait on the mutex itself in short slices, others are polled with backoff.
+     *
+     * @return Whether the lock was acquired.
+     */
+    template <typename Lock>
+    bool acquire(Lock& lock, const std::stop_token& token)
+    {
+        if constexpr (timed_lock<Lock>) {
+            while (not lock.try_lock_for(stop_poll_interval)) {
+                if (token.stop_requested()) {
+                    return false;
+                }
+            }
+            return true;
+        } else {
+            auto backoff = backoff::SpinThenSleep<>{};
+            while (not lock.try_lock()) {
+                if (token.stop_requested()) {
+                    return false;
+                }
+                backoff();
+            }
+            return true;
+        }
+    }
+
+    /**
+     * @brief Convert a time point of any clock to the steady clock.
+     */
+    template <typename Clock, typename Duration>
+    std::chrono::steady_clock::time_point to_steady(const std::chrono::time_point<Clock, Duration>& time)
+    {
+        if constexpr (std::same_as<Clock, std::chrono::steady_clock>) {
+            return std::chrono::time_point_cast<std::chrono::steady_clock::duration>(time);
+        } else {
+            auto remaining = std::chrono::ceil<std::chrono::steady_clock::duration>(time - Clock::now());
+            return std::chrono::steady_clock::now() + remaining;
+        }
+    }
+}
+
+#endif /* end of include guard: SYNC_CPP_DETAIL_ACQUIRE_HPP_Z8CM4HTA */
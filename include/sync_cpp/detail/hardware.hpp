@@ -0,0 +1,60 @@
+#ifndef SYNC_CPP_DETAIL_HARDWARE_HPP_8WQ2KF5N
+#define SYNC_CPP_DETAIL_HARDWARE_HPP_8WQ2KF5N
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+#if defined(_MSC_VER) and (defined(_M_X64) or defined(_M_IX86))
+#    include <intrin.h>
+#endif
+
+namespace spp::detail
+{
+#if defined(__cpp_lib_hardware_interference_size)
+#    if defined(__GNUC__) and not defined(__clang__)
+#        pragma GCC diagnostic push
+#        pragma GCC diagnostic ignored "-Winterference-size"
+#    endif
+    /**
+     * @brief The minimum offset between two objects to avoid false sharing.
+     */
+    inline constexpr std::size_t cache_line_size = std::hardware_destructive_interference_size;
+#    if defined(__GNUC__) and not defined(__clang__)
+#        pragma GCC diagnostic pop
+#    endif
+#else
+    inline constexpr std::size_t cache_line_size = 64;
+#endif
+
+    /**
+     * @brief Hint the processor that we are in a spin-wait loop.
+     */
+    inline void cpu_relax() noexcept
+    {
+#if defined(__x86_64__) or defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__) or defined(__arm__)
+        asm volatile("yield" ::: "memory");
+#elif defined(_MSC_VER) and (defined(_M_X64) or defined(_M_IX86))
+        _mm_pause();
+#endif
+    }
+
+    /**
+     * @brief Map an address to one of a power of two number of buckets.
+     *
+     * @param address The address to hash.
+     * @param buckets The number of buckets, must be a power of two.
+     * @return The index of the bucket.
+     */
+    [[nodiscard]] inline std::size_t address_hash(const void* address, std::size_t buckets) noexcept
+    {
+        // fibonacci hashing, the low bits of an address are mostly zero because of alignment
+        auto value = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(address));
+        auto hash  = (value >> 4) * 0x9E37'79B9'7F4A'7C15;
+        return static_cast<std::size_t>(hash >> 32) & (buckets - 1);
+    }
+}
+
+#endif /* end of include guard: SYNC_CPP_DETAIL_HARDWARE_HPP_8WQ2KF5N */
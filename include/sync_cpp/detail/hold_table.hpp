@@ -0,0 +1,90 @@
+#ifndef SYNC_CPP_DETAIL_HOLD_TABLE_HPP_2KX8GQ4Z
+#define SYNC_CPP_DETAIL_HOLD_TABLE_HPP_2KX8GQ4Z
+
+#include "sync_cpp/mutex/spin_lock.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace spp::detail
+{
+    /**
+     * @class HoldTable
+     *
+     * @brief The locks one thread currently holds through a watched access (see spp::Watchdog).
+     *
+     * Only the owning thread adds and removes holds, the lock is only ever contended by a watchdog scan.
+     */
+    class HoldTable
+    {
+    public:
+        struct Hold
+        {
+            std::uint64_t                         m_id;
+            const void*                           m_mutex;
+            const char*                           m_file;
+            const char*                           m_function;
+            std::uint32_t                         m_line;
+            bool                                  m_shared;
+            std::chrono::steady_clock::time_point m_start;
+        };
+
+        // holds nested deeper than this are not watched
+        static constexpr std::size_t capacity = 16;
+
+        // constructed by the owning thread
+        explicit HoldTable(std::size_t thread)
+            : m_thread{ thread }
+            , m_thread_id{ std::this_thread::get_id() }
+        {
+        }
+
+        // the id of the hold, zero if it's not watched
+        std::uint64_t push(Hold hold) noexcept
+        {
+            auto lock = std::lock_guard{ m_lock };
+            if (m_count == capacity) {
+                return 0;
+            }
+            hold.m_id          = ++m_last_id;
+            m_holds[m_count++] = hold;
+            return hold.m_id;
+        }
+
+        void pop(std::uint64_t id) noexcept
+        {
+            auto lock = std::lock_guard{ m_lock };
+            for (auto i = m_count; i > 0; --i) {
+                if (m_holds[i - 1].m_id == id) {
+                    m_holds[i - 1] = m_holds[--m_count];
+                    return;
+                }
+            }
+        }
+
+        void for_each(auto&& fn) const
+        {
+            auto lock = std::lock_guard{ m_lock };
+            for (auto i = 0u; i < m_count; ++i) {
+                fn(m_holds[i]);
+            }
+        }
+
+        std::size_t     thread() const noexcept { return m_thread; }
+        std::thread::id thread_id() const noexcept { return m_thread_id; }
+
+    private:
+        mutable SpinLock<>         m_lock;
+        std::size_t                m_thread;
+        std::thread::id            m_thread_id;
+        std::array<Hold, capacity> m_holds   = {};
+        std::size_t                m_count   = 0;
+        std::uint64_t              m_last_id = 0;
+    };
+}
+
+#endif /* end of include guard: SYNC_CPP_DETAIL_HOLD_TABLE_HPP_2KX8GQ4Z */
@@ -0,0 +1,56 @@
+#ifndef SYNC_CPP_DETAIL_LISTENERS_HPP_T3JV6QHB
+#define SYNC_CPP_DETAIL_LISTENERS_HPP_T3JV6QHB
+
+#include "sync_cpp/detail/hardware.hpp"
+
+#include <atomic>
+#include <cstddef>
+
+namespace spp::detail
+{
+    /**
+     * @class Listeners
+     *
+     * @brief The number of threads waiting for a condition (see Sync::wait_read) plus the number of
+     * subscriptions (see Sync::subscribe), over every object of the process.
+     *
+     * A write notifies nobody while it is zero, so an object nobody waits on or subscribes to pays a single
+     * load of a line that is only written when a wait or a subscription starts or ends.
+     *
+     * It also holds the subscribers' half of a notification, installed by the notifier when it starts (see
+     * subscription.hpp), so that the core headers don't depend on the notifier.
+     */
+    class Listeners
+    {
+    public:
+        Listeners() = delete;
+
+        // checked after unlocking: a listener registers before checking the value under the lock, so a write
+        // that it could have missed sees it
+        [[nodiscard]] static bool any() noexcept { return s_count.load(std::memory_order_seq_cst) != 0; }
+
+        static void add() noexcept { s_count.fetch_add(1, std::memory_order_seq_cst); }
+        static void remove() noexcept { s_count.fetch_sub(1, std::memory_order_release); }
+
+        using Publish = void (*)(const void* address);
+
+        // installed before the first subscription is counted, so a write that sees it counted sees this too
+        static void set_publish(Publish publish) noexcept
+        {
+            s_publish.store(publish, std::memory_order_release);
+        }
+
+        static void publish(const void* address)
+        {
+            if (auto publish = s_publish.load(std::memory_order_acquire)) {
+                publish(address);
+            }
+        }
+
+    private:
+        alignas(cache_line_size) static inline std::atomic<std::size_t> s_count   = 0;
+        static inline std::atomic<Publish>                              s_publish = nullptr;
+    };
+}
+
+#endif /* end of include guard: SYNC_CPP_DETAIL_LISTENERS_HPP_T3JV6QHB */
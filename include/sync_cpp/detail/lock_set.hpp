@@ -0,0 +1,461 @@
+#ifndef SYNC_CPP_DETAIL_LOCK_SET_HPP_P3XG8MUC
+#define SYNC_CPP_DETAIL_LOCK_SET_HPP_P3XG8MUC
+
+#include "sync_cpp/concepts.hpp"
+#include "sync_cpp/detail/acquire.hpp"
+#include "sync_cpp/lock_policy.hpp"
+#include "sync_cpp/mutex/backoff.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <span>
+#include <stop_token>
+#include <type_traits>
+#include <utility>
+
+namespace spp::detail
+{
+    enum class LockMode
+    {
+        Shared,
+        Exclusive,
+    };
+
+    // run fn with a deferred lock of the requested mode, keep the mutex locked if it returns true
+    template <typename M>
+    bool with_lock(M& mutex, LockMode mode, auto&& fn)
+    {
+        auto keep = [&](auto lock) {
+            if (fn(lock)) {
+                lock.release();
+                return true;
+            }
+            return false;
+        };
+
+        if constexpr (concepts::SharedLockable<M>) {
+            if (mode == LockMode::Shared) {
+                return keep(std::shared_lock{ mutex, std::defer_lock });
+            }
+        }
+        return keep(std::unique_lock{ mutex, std::defer_lock });
+    }
+
+    template <typename M>
+    void unlock(M& mutex, LockMode mode) noexcept
+    {
+        if constexpr (concepts::SharedLockable<M>) {
+            if (mode == LockMode::Shared) {
+                return mutex.unlock_shared();
+            }
+        }
+        mutex.unlock();
+    }
+
+    /**
+     * @class LockRequest
+     *
+     * @brief A type-erased request to lock a mutex, so that mutexes of different types can be ordered.
+     */
+    class LockRequest
+    {
+    public:
+        using Deadline = std::chrono::steady_clock::time_point;
+
+        template <concepts::Lockable M>
+        LockRequest(M& mutex, LockMode mode) noexcept
+            : m_mutex{ &mutex }
+            , m_mode{ concepts::SharedLockable<M> ? mode : LockMode::Exclusive }
+            , m_ops{ &ops_for<M> }
+        {
+        }
+
+        const void* address() const noexcept { return m_mutex; }
+        LockMode    mode() const noexcept { return m_mode; }
+
+        void lock() const { m_ops->m_lock(m_mutex, m_mode); }
+        bool try_lock() const { return m_ops->m_try_lock(m_mutex, m_mode); }
+        void unlock() const noexcept { m_ops->m_unlock(m_mutex, m_mode); }
+
+        bool try_lock_until(Deadline deadline) const
+        {
+            return m_ops->m_lock_until(m_mutex, m_mode, deadline);
+        }
+
+        bool try_lock(const std::stop_token& token) const
+        {
+            return m_ops->m_lock_stop(m_mutex, m_mode, token);
+        }
+
+        // the same mutex requested more than once is locked once, exclusively if any request is exclusive
+        void merge(const LockRequest& other) noexcept { m_mode = std::max(m_mode, other.m_mode); }
+
+    private:
+        struct Ops
+        {
+            void (*m_lock)(void*, LockMode);
+            bool (*m_try_lock)(void*, LockMode);
+            bool (*m_lock_until)(void*, LockMode, Deadline);
+            bool (*m_lock_stop)(void*, LockMode, const std::stop_token&);
+            void (*m_unlock)(void*, LockMode) noexcept;
+        };
+
+        template <typename M>
+        static constexpr Ops ops_for = {
+            .m_lock     = [](void* mutex, LockMode mode) {
+                with_lock(*static_cast<M*>(mutex), mode, [](auto& lock) { return lock.lock(), true; });
+            },
+            .m_try_lock = [](void* mutex, LockMode mode) {
+                return with_lock(*static_cast<M*>(mutex), mode, [](auto& lock) { return lock.try_lock(); });
+            },
+            .m_lock_until = [](void* mutex, LockMode mode, Deadline deadline) {
+                return with_lock(*static_cast<M*>(mutex), mode, [&](auto& lock) {
+                    return acquire(lock, deadline);
+                });
+            },
+            .m_lock_stop = [](void* mutex, LockMode mode, const std::stop_token& token) {
+                return with_lock(*static_cast<M*>(mutex), mode, [&](auto& lock) {
+                    return acquire(lock, token);
+                });
+            },
+            .m_unlock = [](void* mutex, LockMode mode) noexcept {
+                detail::unlock(*static_cast<M*>(mutex), mode);
+            },
+        };
+
+        void*      m_mutex;
+        LockMode   m_mode;
+        const Ops* m_ops;
+    };
+
+    /**
+     * @brief Sort the requests by address and merge the requests of the same mutex into the first of them.
+     *
+     * @return The number of distinct mutexes, their requests are at the front.
+     */
+    inline std::size_t coalesce(std::span<LockRequest> requests) noexcept
+    {
+        auto less = [](const LockRequest& l, const LockRequest& r) {
+            return std::less<const void*>{}(l.address(), r.address());
+        };
+        std::sort(requests.begin(), requests.end(), less);
+
+        auto count = std::size_t{ 0 };
+        for (auto i = std::size_t{ 0 }; i < requests.size(); ++i) {
+            if (count > 0 and requests[count - 1].address() == requests[i].address()) {
+                requests[count - 1].merge(requests[i]);
+            } else {
+                requests[count++] = requests[i];
+            }
+        }
+        return count;
+    }
+
+    /**
+     * @class LockSet
+     *
+     * @brief Lock a set of mutexes, each distinct mutex only once. Unlocks on destruction.
+     *
+     * The same mutex requested more than once is locked once, in the strongest mode requested. The
+     * non-blocking strategies lock in address order and either acquire every mutex or none; since every
+     * LockSet locks in the same global order, LockSets never deadlock each other. The blocking strategy is
+     * given by the Policy (see spp::lock_policy), all of which are deadlock-free too.
+     *
+     * @tparam N The number of lock requests, std::dynamic_extent if only known at runtime: the requests are
+     * then a view of requests already coalesced by the caller (see coalesce), kept alive until destruction.
+     * @tparam Policy How to wait for the locks when blocking.
+     */
+    template <std::size_t N, concepts::LockPolicy Policy = lock_policy::Ordered>
+    class [[nodiscard]] LockSet
+    {
+    public:
+        using Requests = std::conditional_t<
+            N == std::dynamic_extent,
+            std::span<const LockRequest>,
+            std::array<LockRequest, N>>;
+
+        explicit LockSet(Requests requests)
+            : m_requests{ std::move(requests) }
+        {
+            coalesce();
+            if constexpr (std::same_as<Policy, lock_policy::Ordered>) {
+                acquire_ordered([](const LockRequest& r) { return r.lock(), true; });
+            } else {
+                acquire_retrying();
+            }
+        }
+
+        LockSet(Requests requests, std::try_to_lock_t)
+            : m_requests{ std::move(requests) }
+        {
+            coalesce();
+            acquire_ordered([](const LockRequest& r) { return r.try_lock(); });
+        }
+
+        LockSet(Requests requests, LockRequest::Deadline deadline)
+            : m_requests{ std::move(requests) }
+        {
+            coalesce();
+            acquire_ordered([=](const LockRequest& r) { return r.try_lock_until(deadline); });
+        }
+
+        LockSet(Requests requests, const std::stop_token& token)
+            : m_requests{ std::move(requests) }
+        {
+            coalesce();
+            acquire_ordered([&](const LockRequest& r) { return r.try_lock(token); });
+        }
+
+        ~LockSet() { unlock(m_locked); }
+
+        LockSet(const LockSet&)            = delete;
+        LockSet& operator=(const LockSet&) = delete;
+
+        /**
+         * @brief Whether every mutex has been acquired.
+         */
+        bool owns_lock() const noexcept { return m_owns; }
+
+    private:
+        void coalesce() noexcept
+        {
+            if constexpr (N == std::dynamic_extent) {
+                m_count = m_requests.size();
+            } else {
+                m_count = detail::coalesce(m_requests);
+            }
+        }
+
+        // acquire the mutexes in address order until one of them fails (then release all of them)
+        void acquire_ordered(auto&& acquire)
+        {
+            try {
+                while (m_locked < m_count and acquire(m_requests[m_locked])) {
+                    ++m_locked;
+                }
+            } catch (...) {
+                unlock(m_locked);
+                throw;
+            }
+
+            m_owns = m_locked == m_count;
+            if (not m_owns) {
+                unlock(std::exchange(m_locked, 0));
+            }
+        }
+
+        // lock the mutex that was busy last (blocking when parking), try the others after it; when one is
+        // busy release everything, wait, and start over from that one
+        void acquire_retrying()
+        {
+            auto wait  = typename Policy::Wait{};
+            auto first = std::size_t{ 0 };
+            while (m_count > 0) {
+                if constexpr (std::same_as<Policy, lock_policy::Park>) {
+                    m_requests[first].lock();
+                } else if (not m_requests[first].try_lock()) {
+                    wait();
+                    continue;
+                }
+
+                auto busy = try_after(first);
+                if (busy == m_count) {
+                    break;
+                }
+                first = busy;
+                wait();
+            }
+
+            m_locked = m_count;
+            m_owns   = true;
+        }
+
+        // try the mutexes after the locked first one (wrapping around), the index of the busy one if any
+        std::size_t try_after(std::size_t first)
+        {
+            auto at = [&](std::size_t i) -> const LockRequest& { return m_requests[(first + i) % m_count]; };
+
+            auto locked = std::size_t{ 1 };
+            auto fail   = [&] {
+                while (locked > 0) {
+                    at(--locked).unlock();
+                }
+            };
+
+            try {
+                while (locked < m_count and at(locked).try_lock()) {
+                    ++locked;
+                }
+            } catch (...) {
+                fail();
+                throw;
+            }
+
+            if (locked == m_count) {
+                return m_count;
+            }
+            auto busy = (first + locked) % m_count;
+            fail();
+            return busy;
+        }
+
+        void unlock(std::size_t count) noexcept
+        {
+            while (count > 0) {
+                m_requests[--count].unlock();
+            }
+        }
+
+        Requests    m_requests;
+        std::size_t m_count  = 0;
+        std::size_t m_locked = 0;
+        bool        m_owns   = false;
+    };
+
+    /**
+     * @class OrderedLocks
+     *
+     * @brief The statically typed counterpart of LockSet<N, lock_policy::Ordered> for mutexes all of the same
+     * type: the same locking, without the type erasure. Unlocks on destruction.
+     *
+     * It locks in the same address order as LockSet, so the two never deadlock each other.
+     *
+     * @tparam M The type of the mutexes.
+     * @tparam N The number of lock requests.
+     */
+    template <concepts::Lockable M, std::size_t N>
+        requires (N > 0)
+    class [[nodiscard]] OrderedLocks
+    {
+    public:
+        struct Request
+        {
+            Request(M& mutex, LockMode mode) noexcept
+                : m_mutex{ &mutex }
+                , m_mode{ mode }
+            {
+            }
+
+            M*       m_mutex;
+            LockMode m_mode;
+        };
+
+        using Requests = std::array<Request, N>;
+
+        explicit OrderedLocks(Requests requests)
+            : m_requests{ requests }
+        {
+            coalesce();
+            acquire_ordered([](M& mutex, LockMode mode) {
+                if constexpr (concepts::SharedLockable<M>) {
+                    if (mode == LockMode::Shared) {
+                        return mutex.lock_shared(), true;
+                    }
+                }
+                return mutex.lock(), true;
+            });
+        }
+
+        OrderedLocks(Requests requests, std::try_to_lock_t)
+            : m_requests{ requests }
+        {
+            coalesce();
+            acquire_ordered([](M& mutex, LockMode mode) {
+                return with_lock(mutex, mode, [](auto& lock) { return lock.try_lock(); });
+            });
+        }
+
+        OrderedLocks(Requests requests, LockRequest::Deadline deadline)
+            : m_requests{ requests }
+        {
+            coalesce();
+            acquire_ordered([=](M& mutex, LockMode mode) {
+                return with_lock(mutex, mode, [&](auto& lock) { return acquire(lock, deadline); });
+            });
+        }
+
+        OrderedLocks(Requests requests, const std::stop_token& token)
+            : m_requests{ requests }
+        {
+            coalesce();
+            acquire_ordered([&](M& mutex, LockMode mode) {
+                return with_lock(mutex, mode, [&](auto& lock) { return acquire(lock, token); });
+            });
+        }
+
+        ~OrderedLocks() { unlock(m_locked); }
+
+        OrderedLocks(const OrderedLocks&)            = delete;
+        OrderedLocks& operator=(const OrderedLocks&) = delete;
+
+        /**
+         * @brief Whether every mutex has been acquired.
+         */
+        bool owns_lock() const noexcept { return m_owns; }
+
+    private:
+        // sort the requests by address (insertion sort, there are few) and merge those of the same mutex
+        void coalesce() noexcept
+        {
+            auto less = std::less<const M*>{};
+            for (auto i = std::size_t{ 1 }; i < N; ++i) {
+                for (auto j = i; j > 0 and less(m_requests[j].m_mutex, m_requests[j - 1].m_mutex); --j) {
+                    std::swap(m_requests[j], m_requests[j - 1]);
+                }
+            }
+
+            // counted in locals, the members can't stay in registers across the calls to the mutexes
+            auto count = std::size_t{ 1 };
+            for (auto i = std::size_t{ 1 }; i < N; ++i) {
+                if (m_requests[count - 1].m_mutex == m_requests[i].m_mutex) {
+                    auto& merged = m_requests[count - 1].m_mode;
+                    merged       = std::max(merged, m_requests[i].m_mode);
+                } else {
+                    m_requests[count++] = m_requests[i];
+                }
+            }
+            m_count = count;
+        }
+
+        // acquire the mutexes in address order until one of them fails (then release all of them)
+        void acquire_ordered(auto&& acquire)
+        {
+            auto locked = std::size_t{ 0 };
+            try {
+                while (locked < m_count and acquire(*m_requests[locked].m_mutex, m_requests[locked].m_mode)) {
+                    ++locked;
+                }
+            } catch (...) {
+                unlock(locked);
+                throw;
+            }
+
+            m_owns = locked == m_count;
+            if (not m_owns) {
+                unlock(std::exchange(locked, 0));
+            }
+            m_locked = locked;
+        }
+
+        void unlock(std::size_t count) noexcept
+        {
+            while (count > 0) {
+                auto& request = m_requests[--count];
+                detail::unlock(*request.m_mutex, request.m_mode);
+            }
+        }
+
+        Requests    m_requests;
+        std::size_t m_count  = 0;
+        std::size_t m_locked = 0;
+        bool        m_owns   = false;
+    };
+}
+
+#endif /* end of include guard: SYNC_CPP_DETAIL_LOCK_SET_HPP_P3XG8MUC */
@@ -0,0 +1,31 @@
+#ifndef SYNC_CPP_DETAIL_OPTIONAL_RESULT_HPP_E1XR6M2B
+#define SYNC_CPP_DETAIL_OPTIONAL_RESULT_HPP_E1XR6M2B
+
+#include <functional>
+#include <optional>
+#include <type_traits>
+
+namespace spp::detail
+{
+    /**
+     * @brief The result of a function call that may not happen: std::optional<R>, or bool if R is void.
+     */
+    template <typename R>
+    using OptionalResult = std::conditional_t<std::is_void_v<R>, bool, std::optional<R>>;
+
+    /**
+     * @brief Invoke a function and wrap its result into an engaged OptionalResult.
+     */
+    template <typename Fn, typename... Args>
+    OptionalResult<std::invoke_result_t<Fn, Args...>> invoke_optional(Fn&& fn, Args&&... args)
+    {
+        if constexpr (std::is_void_v<std::invoke_result_t<Fn, Args...>>) {
+            std::invoke(std::forward<Fn>(fn), std::forward<Args>(args)...);
+            return true;
+        } else {
+            return std::invoke(std::forward<Fn>(fn), std::forward<Args>(args)...);
+        }
+    }
+}
+
+#endif /* end of include guard: SYNC_CPP_DETAIL_OPTIONAL_RESULT_HPP_E1XR6M2B */
@@ -0,0 +1,52 @@
+#ifndef SYNC_CPP_DETAIL_TASK_HPP_V8LQ2RXE
+#define SYNC_CPP_DETAIL_TASK_HPP_V8LQ2RXE
+
+#include <concepts>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace spp::detail
+{
+    /**
+     * @class Task
+     *
+     * @brief A move-only type-erased void() callable.
+     */
+    class Task
+    {
+    public:
+        template <typename Fn>
+            requires std::invocable<std::decay_t<Fn>&> and (not std::same_as<std::decay_t<Fn>, Task>)
+        Task(Fn&& fn)
+            : m_callable{ std::make_unique<Callable<std::decay_t<Fn>>>(std::forward<Fn>(fn)) }
+        {
+        }
+
+        void operator()() { m_callable->run(); }
+
+    private:
+        struct Base
+        {
+            virtual ~Base()    = default;
+            virtual void run() = 0;
+        };
+
+        template <typename Fn>
+        struct Callable final : Base
+        {
+            explicit Callable(auto&& fn)
+                : m_fn{ std::forward<decltype(fn)>(fn) }
+            {
+            }
+
+            void run() override { m_fn(); }
+
+            Fn m_fn;
+        };
+
+        std::unique_ptr<Base> m_callable;
+    };
+}
+
+#endif /* end of include guard: SYNC_CPP_DETAIL_TASK_HPP_V8LQ2RXE */
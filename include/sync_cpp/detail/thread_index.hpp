@@ -0,0 +1,23 @@
+#ifndef SYNC_CPP_DETAIL_THREAD_INDEX_HPP_J2H7V0LE
+#define SYNC_CPP_DETAIL_THREAD_INDEX_HPP_J2H7V0LE
+
+#include <atomic>
+#include <cstddef>
+
+namespace spp::detail
+{
+    /**
+     * @brief Get a small, process-wide unique index for the calling thread.
+     *
+     * The indices are handed out sequentially as threads first call this function, which makes them well
+     * suited to spread threads across per-thread slots (index modulo slot count).
+     */
+    inline std::size_t thread_index() noexcept
+    {
+        static auto             s_counter = std::atomic<std::size_t>{ 0 };
+        thread_local const auto t_index   = s_counter.fetch_add(1, std::memory_order_relaxed);
+        return t_index;
+    }
+}
+
+#endif /* end of include guard: SYNC_CPP_DETAIL_THREAD_INDEX_HPP_J2H7V0LE */
@@ -0,0 +1,72 @@
+#ifndef SYNC_CPP_DETAIL_THREAD_REGISTRY_HPP_V6RC9E1J
+#define SYNC_CPP_DETAIL_THREAD_REGISTRY_HPP_V6RC9E1J
+
+#include "sync_cpp/detail/thread_index.hpp"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace spp::detail
+{
+    /**
+     * @class ThreadRegistry
+     *
+     * @brief The process-wide list of the per-thread buffers of one kind, readable by any thread.
+     *
+     * A buffer is created on the first use by its thread (constructed with the thread's index) and outlives
+     * the thread until pruned.
+     *
+     * @tparam Buffer The per-thread buffer type, it does its own synchronization with readers.
+     */
+    template <typename Buffer>
+    class ThreadRegistry
+    {
+    public:
+        static ThreadRegistry& instance()
+        {
+            static auto s_registry = ThreadRegistry{};
+            return s_registry;
+        }
+
+        ThreadRegistry(const ThreadRegistry&)            = delete;
+        ThreadRegistry& operator=(const ThreadRegistry&) = delete;
+
+        Buffer& local()
+        {
+            thread_local auto t_buffer = add();
+            return *t_buffer;
+        }
+
+        void for_each(auto&& fn) const
+        {
+            auto lock = std::lock_guard{ m_mutex };
+            for (const auto& buffer : m_buffers) {
+                fn(*buffer);
+            }
+        }
+
+        // forget the buffers of the threads that exited
+        void prune()
+        {
+            auto lock = std::lock_guard{ m_mutex };
+            std::erase_if(m_buffers, [](const auto& buffer) { return buffer.use_count() == 1; });
+        }
+
+    private:
+        ThreadRegistry() = default;
+
+        std::shared_ptr<Buffer> add()
+        {
+            auto buffer = std::make_shared<Buffer>(thread_index());
+            auto lock   = std::lock_guard{ m_mutex };
+            m_buffers.push_back(buffer);
+            return buffer;
+        }
+
+        mutable std::mutex                   m_mutex;
+        std::vector<std::shared_ptr<Buffer>> m_buffers;
+    };
+}
+
+#endif /* end of include guard: SYNC_CPP_DETAIL_THREAD_REGISTRY_HPP_V6RC9E1J */
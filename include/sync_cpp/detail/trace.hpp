@@ -0,0 +1,229 @@
+#ifndef SYNC_CPP_DETAIL_TRACE_HPP_5QZ3N8TW
+#define SYNC_CPP_DETAIL_TRACE_HPP_5QZ3N8TW
+
+#include <cstddef>
+#include <cstdint>
+
+// the lock events of Sync and Group accesses are hooked by tracing and by the watchdog
+#if defined(SYNC_CPP_TRACE) or defined(SYNC_CPP_WATCHDOG)
+#    define SYNC_CPP_DETAIL_LOCK_HOOKS
+#    include <chrono>
+#    include <source_location>
+#endif
+
+#if defined(SYNC_CPP_TRACE)
+#    include "sync_cpp/detail/thread_registry.hpp"
+#    include "sync_cpp/mutex/spin_lock.hpp"
+
+#    include <algorithm>
+#    include <mutex>
+#    include <vector>
+
+#    if not defined(SYNC_CPP_TRACE_BUFFER_SIZE)
+#        define SYNC_CPP_TRACE_BUFFER_SIZE 8192
+#    endif
+#endif
+
+#if defined(SYNC_CPP_WATCHDOG)
+#    include "sync_cpp/detail/hold_table.hpp"
+#    include "sync_cpp/detail/thread_registry.hpp"
+#endif
+
+namespace spp::detail
+{
+    enum class TracePhase : unsigned char
+    {
+        Wait,       // started waiting for the lock
+        Acquire,    // acquired the lock
+        Release,    // released the lock (or gave up waiting, see TraceScope)
+    };
+
+    /**
+     * @class TraceEvent
+     *
+     * @brief A lock event recorded by a traced access, the call site strings have static storage.
+     */
+    struct TraceEvent
+    {
+        std::uint64_t m_time;        // nanoseconds since the first traced event of the process
+        const void*   m_mutex;       // the (first) mutex locked
+        const char*   m_file;        // empty if the call site is unknown
+        const char*   m_function;    // empty if the call site is unknown
+        std::uint32_t m_line;
+        std::uint32_t m_count;       // the number of mutexes locked together (Group)
+        TracePhase    m_phase;
+        bool          m_shared;
+    };
+
+#if defined(SYNC_CPP_TRACE)
+    inline constexpr bool trace_enabled = true;
+
+    /**
+     * @class TraceBuffer
+     *
+     * @brief A fixed size ring of the events of one thread, the oldest events are overwritten.
+     *
+     * Only the owning thread writes, the lock is only ever contended by a concurrent snapshot.
+     */
+    class TraceBuffer
+    {
+    public:
+        static constexpr std::size_t capacity = SYNC_CPP_TRACE_BUFFER_SIZE;
+
+        explicit TraceBuffer(std::size_t thread)
+            : m_thread{ thread }
+            , m_events(capacity)
+        {
+        }
+
+        void push(const TraceEvent& event) noexcept
+        {
+            auto lock                       = std::lock_guard{ m_lock };
+            m_events[m_written % capacity]  = event;
+            m_written                      += 1;
+        }
+
+        // oldest first
+        std::vector<TraceEvent> events() const
+        {
+            auto lock   = std::lock_guard{ m_lock };
+            auto count  = std::min<std::uint64_t>(m_written, capacity);
+            auto events = std::vector<TraceEvent>{};
+            events.reserve(count);
+            for (auto i = m_written - count; i < m_written; ++i) {
+                events.push_back(m_events[i % capacity]);
+            }
+            return events;
+        }
+
+        void clear() noexcept
+        {
+            auto lock = std::lock_guard{ m_lock };
+            m_written = 0;
+        }
+
+        std::size_t thread() const noexcept { return m_thread; }
+
+    private:
+        mutable SpinLock<>      m_lock;
+        std::size_t             m_thread;
+        std::vector<TraceEvent> m_events;
+        std::uint64_t           m_written = 0;
+    };
+
+    using TraceRegistry = ThreadRegistry<TraceBuffer>;
+
+    // the origin of the event timestamps
+    inline std::chrono::steady_clock::time_point trace_epoch() noexcept
+    {
+        static const auto s_epoch = std::chrono::steady_clock::now();
+        return s_epoch;
+    }
+#else
+    inline constexpr bool trace_enabled = false;
+#endif
+
+#if defined(SYNC_CPP_WATCHDOG)
+    inline constexpr bool watchdog_enabled = true;
+
+    using HoldRegistry = ThreadRegistry<HoldTable>;
+#else
+    inline constexpr bool watchdog_enabled = false;
+#endif
+
+#if defined(SYNC_CPP_DETAIL_LOCK_HOOKS)
+    using CallSite = std::source_location;
+
+    /**
+     * @class TraceScope
+     *
+     * @brief Records the lock events of one access, for tracing and/or for the watchdog.
+     *
+     * Construct it right before locking, call acquired() once locked, and destroy it after unlocking (declare
+     * it before the lock). An access that never acquires (exception) records its release anyway so that the
+     * wait is closed on the timeline.
+     */
+    class TraceScope
+    {
+    public:
+        TraceScope(const CallSite& site, const void* mutex, bool shared, std::size_t count = 1)
+            : m_site{ site }
+            , m_mutex{ mutex }
+            , m_count{ static_cast<std::uint32_t>(count) }
+            , m_shared{ shared }
+        {
+            record(TracePhase::Wait);
+        }
+
+        TraceScope(const TraceScope&)            = delete;
+        TraceScope& operator=(const TraceScope&) = delete;
+
+        ~TraceScope()
+        {
+#if defined(SYNC_CPP_WATCHDOG)
+            if (m_hold != 0) {
+                HoldRegistry::instance().local().pop(m_hold);
+            }
+#endif
+            record(TracePhase::Release);
+        }
+
+        void acquired()
+        {
+            record(TracePhase::Acquire);
+#if defined(SYNC_CPP_WATCHDOG)
+            m_hold = HoldRegistry::instance().local().push({
+                .m_id       = 0,
+                .m_mutex    = m_mutex,
+                .m_file     = m_site.file_name(),
+                .m_function = m_site.function_name(),
+                .m_line     = m_site.line(),
+                .m_shared   = m_shared,
+                .m_start    = std::chrono::steady_clock::now(),
+            });
+#endif
+        }
+
+    private:
+        void record([[maybe_unused]] TracePhase phase)
+        {
+#if defined(SYNC_CPP_TRACE)
+            auto elapsed = std::chrono::steady_clock::now() - trace_epoch();
+            TraceRegistry::instance().local().push({
+                .m_time     = static_cast<std::uint64_t>(std::chrono::nanoseconds{ elapsed }.count()),
+                .m_mutex    = m_mutex,
+                .m_file     = m_site.file_name(),
+                .m_function = m_site.function_name(),
+                .m_line     = m_site.line(),
+                .m_count    = m_count,
+                .m_phase    = phase,
+                .m_shared   = m_shared,
+            });
+#endif
+        }
+
+        CallSite                       m_site;
+        const void*                    m_mutex;
+        [[maybe_unused]] std::uint32_t m_count;
+        bool                           m_shared;
+#if defined(SYNC_CPP_WATCHDOG)
+        std::uint64_t m_hold = 0;
+#endif
+    };
+#else
+    // stands in for std::source_location when no lock hook is compiled in
+    struct CallSite
+    {
+        static constexpr CallSite current() noexcept { return {}; }
+    };
+
+    // records nothing, no lock hook is compiled in
+    struct TraceScope
+    {
+        constexpr TraceScope(const CallSite&, const void*, bool, std::size_t = 1) noexcept { }
+        constexpr void acquired() noexcept { }
+    };
+#endif
+}
+
+#endif /* end of include guard: SYNC_CPP_DETAIL_TRACE_HPP_5QZ3N8TW */
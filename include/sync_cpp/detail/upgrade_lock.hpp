@@ -0,0 +1,47 @@
+#ifndef SYNC_CPP_DETAIL_UPGRADE_LOCK_HPP_Q2LF6NWA
+#define SYNC_CPP_DETAIL_UPGRADE_LOCK_HPP_Q2LF6NWA
+
+#include "sync_cpp/concepts.hpp"
+
+namespace spp::detail
+{
+    /**
+     * @class UpgradeLock
+     *
+     * @brief Holds the upgrade lock of a mutex, or its exclusive lock once upgraded. Unlocks on destruction.
+     */
+    template <concepts::UpgradeLockable M>
+    class [[nodiscard]] UpgradeLock
+    {
+    public:
+        explicit UpgradeLock(M& mutex)
+            : m_mutex{ mutex }
+        {
+            m_mutex.lock_upgrade();
+        }
+
+        ~UpgradeLock()
+        {
+            if (m_exclusive) {
+                m_mutex.unlock();
+            } else {
+                m_mutex.unlock_upgrade();
+            }
+        }
+
+        UpgradeLock(const UpgradeLock&)            = delete;
+        UpgradeLock& operator=(const UpgradeLock&) = delete;
+
+        void upgrade()
+        {
+            m_mutex.unlock_upgrade_and_lock();
+            m_exclusive = true;
+        }
+
+    private:
+        M&   m_mutex;
+        bool m_exclusive = false;
+    };
+}
+
+#endif /* end of include guard: SYNC_CPP_DETAIL_UPGRADE_LOCK_HPP_Q2LF6NWA */
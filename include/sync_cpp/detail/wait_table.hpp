@@ -0,0 +1,245 @@
+#ifndef SYNC_CPP_DETAIL_WAIT_TABLE_HPP_Q5RT8WDM
+#define SYNC_CPP_DETAIL_WAIT_TABLE_HPP_Q5RT8WDM
+
+#include "sync_cpp/detail/hardware.hpp"
+#include "sync_cpp/detail/listeners.hpp"
+#include "sync_cpp/mutex/backoff.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#if defined(__linux__)
+#    include <climits>
+#    include <ctime>
+#    include <linux/futex.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
+
+namespace spp::detail
+{
+    // the threads waiting on the objects of a bucket, and the word they park on
+    struct alignas(cache_line_size) WaitBucket
+    {
+        std::atomic<std::uint32_t> m_waiters = 0;
+        std::atomic<std::uint32_t> m_epoch   = 0;
+    };
+
+    /**
+     * @class WaitTable
+     *
+     * @brief A process-wide table of wait queues, objects are mapped to a bucket by their address (see
+     * Sync::wait_read).
+     *
+     * A bucket counts the threads waiting on any of its objects and holds an epoch word they park on, so a
+     * Sync object pays nothing for being waitable: a write checks the process-wide count of listeners after
+     * unlocking (see Listeners), then the waiter count of its bucket, and only bumps the epoch and wakes the
+     * bucket when someone waits there. Unrelated objects may share a bucket, their waiters then wake up
+     * spuriously and check their condition again.
+     *
+     * On Linux the epoch is a futex, waited on with a timeout; elsewhere the waits go through
+     * std::atomic::wait/notify, and a timed wait polls with backoff.
+     */
+    class WaitTable
+    {
+    public:
+        static constexpr std::size_t buckets = 256;
+
+        WaitTable() = delete;
+
+        [[nodiscard]] static WaitBucket& bucket_for(const void* address) noexcept
+        {
+            return s_buckets[address_hash(address, buckets)];
+        }
+
+        /**
+         * @brief Wake the threads waiting on the bucket of an address, if any; called after unlocking.
+         */
+        static void notify(const void* address) noexcept
+        {
+            auto& bucket = bucket_for(address);
+            if (bucket.m_waiters.load(std::memory_order_seq_cst) == 0) {
+                return;
+            }
+            bucket.m_epoch.fetch_add(1, std::memory_order_seq_cst);
+            wake_all(bucket.m_epoch);
+        }
+
+        /**
+         * @brief Block until the epoch differs from the one read before checking the condition.
+         */
+        static void wait(WaitBucket& bucket, std::uint32_t epoch) noexcept
+        {
+#if defined(__linux__)
+            while (bucket.m_epoch.load(std::memory_order_acquire) == epoch) {
+                futex(bucket.m_epoch, FUTEX_WAIT_PRIVATE, epoch, nullptr);
+            }
+#else
+            bucket.m_epoch.wait(epoch, std::memory_order_acquire);
+#endif
+        }
+
+        /**
+         * @brief Block until the epoch differs from the one read before checking the condition, or until the
+         * deadline.
+         *
+         * @return false on timeout.
+         */
+        static bool wait(
+            WaitBucket&                                  bucket,
+            std::uint32_t                                epoch,
+            const std::chrono::steady_clock::time_point& deadline
+        ) noexcept
+        {
+#if defined(__linux__)
+            while (bucket.m_epoch.load(std::memory_order_acquire) == epoch) {
+                auto remaining = deadline - std::chrono::steady_clock::now();
+                if (remaining <= remaining.zero()) {
+                    return false;
+                }
+                auto seconds = std::chrono::duration_cast<std::chrono::seconds>(remaining);
+                auto nanos   = std::chrono::duration_cast<std::chrono::nanoseconds>(remaining - seconds);
+                auto timeout = timespec{
+                    .tv_sec  = static_cast<decltype(timespec::tv_sec)>(seconds.count()),
+                    .tv_nsec = static_cast<decltype(timespec::tv_nsec)>(nanos.count()),
+                };
+                futex(bucket.m_epoch, FUTEX_WAIT_PRIVATE, epoch, &timeout);
+            }
+            return true;
+#else
+            auto backoff = backoff::SpinThenSleep<>{};
+            while (bucket.m_epoch.load(std::memory_order_acquire) == epoch) {
+                if (std::chrono::steady_clock::now() >= deadline) {
+                    return false;
+                }
+                backoff();
+            }
+            return true;
+#endif
+        }
+
+    private:
+        static void wake_all(std::atomic<std::uint32_t>& word) noexcept
+        {
+#if defined(__linux__)
+            futex(word, FUTEX_WAKE_PRIVATE, INT_MAX, nullptr);
+#else
+            word.notify_all();
+#endif
+        }
+
+#if defined(__linux__)
+        // a std::atomic<std::uint32_t> has the layout of the 32-bit word the kernel expects
+        static void futex(
+            std::atomic<std::uint32_t>& word,
+            int                         op,
+            std::uint32_t               value,
+            const timespec*             timeout
+        ) noexcept
+        {
+            ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), op, value, timeout, nullptr, 0);
+        }
+#endif
+
+        static inline std::array<WaitBucket, buckets> s_buckets = {};
+    };
+
+    /**
+     * @class WaitRegistration
+     *
+     * @brief Counts the calling thread as a waiter of a bucket for its lifetime.
+     */
+    class WaitRegistration
+    {
+    public:
+        explicit WaitRegistration(WaitBucket& bucket) noexcept
+            : m_bucket{ bucket }
+        {
+            Listeners::add();
+            m_bucket.m_waiters.fetch_add(1, std::memory_order_seq_cst);
+        }
+
+        ~WaitRegistration()
+        {
+            m_bucket.m_waiters.fetch_sub(1, std::memory_order_relaxed);
+            Listeners::remove();
+        }
+
+        WaitRegistration(const WaitRegistration&)            = delete;
+        WaitRegistration& operator=(const WaitRegistration&) = delete;
+
+        WaitBucket& bucket() const noexcept { return m_bucket; }
+
+    private:
+        WaitBucket& m_bucket;
+    };
+
+    /**
+     * @class NotifyScope
+     *
+     * @brief Notifies the waiters and the subscribers (see Sync::subscribe) of the written objects (by
+     * address, nullptr for none) on destruction.
+     *
+     * Declared before the locks, so that the waiters are woken after unlocking.
+     *
+     * @tparam N The number of objects, or std::dynamic_extent for a runtime number (then a view of addresses
+     * kept alive by the caller).
+     */
+    template <std::size_t N>
+    class NotifyScope
+    {
+    public:
+        using Addresses = std::conditional_t<
+            N == std::dynamic_extent,
+            std::span<const void* const>,
+            std::array<const void*, N>>;
+
+        explicit NotifyScope(Addresses addresses) noexcept
+            : m_addresses{ std::move(addresses) }
+        {
+        }
+
+        explicit NotifyScope(const void* address) noexcept
+            requires (N == 1)
+            : m_addresses{ address }
+        {
+        }
+
+        NotifyScope(const NotifyScope&)            = delete;
+        NotifyScope& operator=(const NotifyScope&) = delete;
+
+        // a single load when nobody waits or subscribes anywhere
+        ~NotifyScope()
+        {
+            if (m_dismissed or not Listeners::any()) {
+                return;
+            }
+            notify();
+        }
+
+        // nothing was written after all
+        void dismiss() noexcept { m_dismissed = true; }
+
+    private:
+        void notify() const
+        {
+            for (auto* address : m_addresses) {
+                if (address != nullptr) {
+                    WaitTable::notify(address);
+                    Listeners::publish(address);
+                }
+            }
+        }
+
+        Addresses m_addresses;
+        bool      m_dismissed = false;
+    };
+}
+
+#endif /* end of include guard: SYNC_CPP_DETAIL_WAIT_TABLE_HPP_Q5RT8WDM */
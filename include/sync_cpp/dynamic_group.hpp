@@ -0,0 +1,254 @@
+#ifndef SYNC_CPP_DYNAMIC_GROUP_HPP_8MW3KJ5T
+#define SYNC_CPP_DYNAMIC_GROUP_HPP_8MW3KJ5T
+
+#include "sync_cpp/concepts.hpp"
+#include "sync_cpp/detail/lock_set.hpp"
+#include "sync_cpp/detail/optional_result.hpp"
+#include "sync_cpp/detail/trace.hpp"
+#include "sync_cpp/detail/wait_table.hpp"
+#include "sync_cpp/lock_policy.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace spp
+{
+    namespace detail
+    {
+        // the Sync type of a range of Sync objects or of pointers to Sync objects
+        template <typename R>
+        using RangeSync = std::remove_pointer_t<std::remove_reference_t<std::ranges::range_reference_t<R>>>;
+    }
+
+    namespace concepts
+    {
+        /**
+         * @brief A range of Sync objects (or of pointers to them) of the same type.
+         */
+        template <typename R>
+        concept SyncRange = std::ranges::input_range<R> and SyncDerivative<detail::RangeSync<R>>
+                        and (std::is_lvalue_reference_v<std::ranges::range_reference_t<R>>
+                             or std::is_pointer_v<std::remove_cvref_t<std::ranges::range_reference_t<R>>>);
+    }
+
+    /**
+     * @class DynamicGroup
+     *
+     * @brief A group of Sync objects of the same type whose number is only known at runtime.
+     *
+     * Like Group, the locks are acquired without deadlocking any other group (see spp::lock_policy) and a
+     * mutex shared by several objects is locked once. The function is called with the values in the order
+     * of the objects; an object given more than once appears more than once.
+     *
+     * @tparam S The Sync objects actual type (derived from spp::Sync), const for read-only access.
+     * @tparam Policy How to wait for the locks (see spp::lock_policy).
+     */
+    template <concepts::SyncDerivative S, concepts::LockPolicy Policy = lock_policy::Ordered>
+    class [[nodiscard]] DynamicGroup
+    {
+    public:
+        using Value = std::conditional_t<std::is_const_v<S>, const typename S::Value, typename S::Value>;
+
+        template <typename V>
+        using Values = std::span<const std::reference_wrapper<V>>;
+
+        /**
+         * @param syncs The Sync objects to group.
+         */
+        explicit DynamicGroup(std::vector<S*> syncs)
+            : m_syncs{ std::move(syncs) }
+        {
+            // the objects are fixed, so are the (coalesced) lock requests, values and addresses of an access
+            m_shared.reserve(m_syncs.size());
+            m_const_values.reserve(m_syncs.size());
+            for (auto* sync : m_syncs) {
+                m_shared.emplace_back(sync->mutex(), detail::LockMode::Shared);
+                m_const_values.emplace_back(sync->m_value);
+            }
+            coalesce(m_shared);
+
+            if constexpr (not std::is_const_v<S>) {
+                m_exclusive.reserve(m_syncs.size());
+                m_values.reserve(m_syncs.size());
+                m_addresses.reserve(m_syncs.size());
+                for (auto* sync : m_syncs) {
+                    m_exclusive.emplace_back(sync->mutex(), detail::LockMode::Exclusive);
+                    m_values.emplace_back(sync->m_value);
+                    m_addresses.push_back(&sync->m_value);
+                }
+                coalesce(m_exclusive);
+            }
+        }
+
+        std::size_t size() const noexcept { return m_syncs.size(); }
+
+        /**
+         * @brief Access all the Sync object's values in a read-only context.
+         *
+         * @param fn The function to call with the values.
+         * @param site The call site recorded by tracing and the watchdog, when compiled in.
+         *
+         * @return The return value of the function.
+         */
+        [[nodiscard]] decltype(auto) read(
+            std::invocable<Values<const typename S::Value>> auto&& fn,
+            detail::CallSite                                    site = detail::CallSite::current()
+        ) const
+        {
+            using Ret = std::invoke_result_t<decltype(fn), Values<const typename S::Value>>;
+            static_assert(
+                not std::is_lvalue_reference_v<Ret>,
+                "Function returning a reference in multithreaded context is dangerous! Consider copying "
+                "instead."
+            );
+
+            auto trace = trace_locks(site, true);
+            auto locks = Locks{ m_shared };
+            trace.acquired();
+            return std::forward<decltype(fn)>(fn)(Values<const typename S::Value>{ m_const_values });
+        }
+
+        /**
+         * @brief Access all the Sync object's values in a read-write context.
+         *
+         * @param fn The function to call with the values.
+         * @param site The call site recorded by tracing and the watchdog, when compiled in.
+         *
+         * @return The return value of the function.
+         */
+        [[nodiscard]] decltype(auto) write(
+            std::invocable<Values<Value>> auto&& fn,
+            detail::CallSite                     site = detail::CallSite::current()
+        ) const
+            requires (not std::is_const_v<S>)
+        {
+            using Ret = std::invoke_result_t<decltype(fn), Values<Value>>;
+            static_assert(
+                not std::is_lvalue_reference_v<Ret>,
+                "Function returning a reference in multithreaded context is dangerous! Consider copying "
+                "instead."
+            );
+
+            auto notify = notify_written();
+            auto trace  = trace_locks(site, false);
+            auto locks  = Locks{ m_exclusive };
+            trace.acquired();
+            return std::forward<decltype(fn)>(fn)(Values<Value>{ m_values });
+        }
+
+        /**
+         * @brief Access all the Sync object's values in a read-only context, only if every lock is free now.
+         *
+         * Either every lock is acquired or none.
+         *
+         * @param fn The function to call with the values.
+         *
+         * @return The return value of the function (or true if it returns void), empty if a lock is busy.
+         */
+        [[nodiscard]] auto try_read(std::invocable<Values<const typename S::Value>> auto&& fn) const
+        {
+            using Result = detail::OptionalResult<
+                std::invoke_result_t<decltype(fn), Values<const typename S::Value>>>;
+
+            auto locks = Locks{ m_shared, std::try_to_lock };
+            if (not locks.owns_lock()) {
+                return Result{};
+            }
+            return detail::invoke_optional(
+                std::forward<decltype(fn)>(fn),
+                Values<const typename S::Value>{ m_const_values }
+            );
+        }
+
+        /**
+         * @brief Access all the Sync object's values in a read-write context, only if every lock is free now.
+         *
+         * Either every lock is acquired or none.
+         *
+         * @param fn The function to call with the values.
+         *
+         * @return The return value of the function (or true if it returns void), empty if a lock is busy.
+         */
+        [[nodiscard]] auto try_write(std::invocable<Values<Value>> auto&& fn) const
+            requires (not std::is_const_v<S>)
+        {
+            using Result = detail::OptionalResult<std::invoke_result_t<decltype(fn), Values<Value>>>;
+
+            auto notify = notify_written();
+            auto locks  = Locks{ m_exclusive, std::try_to_lock };
+            if (not locks.owns_lock()) {
+                notify.dismiss();
+                return Result{};
+            }
+            return detail::invoke_optional(std::forward<decltype(fn)>(fn), Values<Value>{ m_values });
+        }
+
+    private:
+        using Locks = detail::LockSet<std::dynamic_extent, Policy>;
+
+        // keep one request per distinct mutex, in address order
+        static void coalesce(std::vector<detail::LockRequest>& requests)
+        {
+            auto count = static_cast<std::ptrdiff_t>(detail::coalesce(requests));
+            requests.erase(requests.begin() + count, requests.end());
+        }
+
+        // declared before the locks, so that the waiters (see Sync::wait_read) and the subscribers are
+        // notified after unlocking
+        [[nodiscard]] detail::NotifyScope<std::dynamic_extent> notify_written() const
+        {
+            return detail::NotifyScope<std::dynamic_extent>{ m_addresses };
+        }
+
+        // recorded as a single lock of the first object's mutex, declared before the locks
+        [[nodiscard]] detail::TraceScope trace_locks(const detail::CallSite& site, bool shared) const
+        {
+            auto first = m_syncs.empty() ? nullptr : static_cast<const void*>(&m_syncs.front()->mutex());
+            return { site, first, shared, m_syncs.size() };
+        }
+
+        std::vector<S*>                                              m_syncs;
+        std::vector<detail::LockRequest>                             m_shared;
+        std::vector<detail::LockRequest>                             m_exclusive;    // if writable
+        std::vector<std::reference_wrapper<const typename S::Value>> m_const_values;
+        std::vector<std::reference_wrapper<Value>>                   m_values;       // if writable
+        std::vector<const void*>                                     m_addresses;    // if writable
+    };
+
+    /**
+     * @brief Make a group of a runtime number of Sync objects.
+     *
+     * @tparam Policy How to wait for the locks (see spp::lock_policy), e.g. spp::group<Park>(shards).
+     *
+     * @param syncs A range of Sync objects or of pointers to Sync objects, e.g. std::span<Sync<T>> or
+     * std::vector<Sync<T>*>; a range of const objects makes a read-only group.
+     *
+     * @return A DynamicGroup object referring to the Sync objects.
+     */
+    template <concepts::LockPolicy Policy = lock_policy::Ordered, concepts::SyncRange R>
+    DynamicGroup<detail::RangeSync<R>, Policy> group(R&& syncs)
+    {
+        using S = detail::RangeSync<R>;
+
+        auto pointers = std::vector<S*>{};
+        if constexpr (std::ranges::sized_range<R>) {
+            pointers.reserve(std::ranges::size(syncs));
+        }
+        for (auto&& sync : syncs) {
+            if constexpr (std::is_pointer_v<std::remove_cvref_t<decltype(sync)>>) {
+                pointers.push_back(sync);
+            } else {
+                pointers.push_back(&sync);
+            }
+        }
+        return DynamicGroup<S, Policy>{ std::move(pointers) };
+    }
+}
+
+#endif /* end of include guard: SYNC_CPP_DYNAMIC_GROUP_HPP_8MW3KJ5T */
@@ -2,43 +2,68 @@
 #define SYNC_CPP_SYNC_GROUP_HPP_43OEW98IRFDU
 
 #include "sync_cpp/concepts.hpp"
+#include "sync_cpp/detail/acquire.hpp"
+#include "sync_cpp/detail/lock_set.hpp"
+#include "sync_cpp/detail/optional_result.hpp"
+#include "sync_cpp/detail/trace.hpp"
+#include "sync_cpp/detail/wait_table.hpp"
+#include "sync_cpp/lock_policy.hpp"
 
+#include <array>
+#include <chrono>
+#include <concepts>
 #include <mutex>
 #include <shared_mutex>
+#include <stop_token>
+#include <tuple>
 
 namespace spp
 {
+    template <concepts::LockPolicy Policy, typename... Ts>
+    class [[nodiscard]] BasicGroup;
+
+    /**
+     * @brief A group locking with the default lock_policy::Ordered.
+     */
     template <typename... Ts>
-    class [[nodiscard]] Group;
+    using Group = BasicGroup<lock_policy::Ordered, Ts...>;
 
-    template <concepts::SyncDerivative... Ts>
-    Group<Ts...> group(Ts&... syncs);
+    template <concepts::LockPolicy Policy = lock_policy::Ordered, concepts::SyncDerivative... Ts>
+    BasicGroup<Policy, Ts...> group(Ts&... syncs);
 
     /**
-     * @class Group
+     * @class BasicGroup
      *
      * @brief A group of Sync objects wrapper.
      *
+     * The locks are acquired without deadlocking any other group, whatever the order of the objects in each
+     * group (see spp::lock_policy), and a mutex shared by several objects is locked once.
+     *
+     * @tparam Policy How to wait for the locks (see spp::lock_policy).
      * @tparam Ts The Sync objects actual types (derived from spp::Sync).
      */
-    template <typename... Ts>
-    class [[nodiscard]] Group
+    template <concepts::LockPolicy Policy, typename... Ts>
+    class [[nodiscard]] BasicGroup
     {
     private:
         template <typename T>
         using Value = std::conditional_t<std::is_const_v<T>, const typename T::Value, typename T::Value>;
 
     public:
-        friend Group<Ts...> group<Ts...>(Ts&... syncs);
+        friend BasicGroup<Policy, Ts...> group<Policy, Ts...>(Ts&... syncs);
 
         /**
          * @brief Access all the Sync object's values in a read-only context.
          *
          * @param fn The function to call with the value.
+         * @param site The call site recorded by tracing and the watchdog, when compiled in.
          *
          * @return The return value of the function.
          */
-        [[nodiscard]] decltype(auto) read(std::invocable<const Value<Ts>&...> auto&& fn) const
+        [[nodiscard]] decltype(auto) read(
+            std::invocable<const Value<Ts>&...> auto&& fn,
+            detail::CallSite                           site = detail::CallSite::current()
+        ) const
         {
             auto handler = [&]<std::size_t... Is>(std::index_sequence<Is...>) -> decltype(auto) {
                 return std::forward<decltype(fn)>(fn)(std::get<Is>(m_syncs).m_value...);
@@ -50,7 +75,9 @@ namespace spp
                 "instead."
             );
 
-            auto locks = lock_read();
+            auto trace = trace_locks(site, true);
+            auto locks = lock_all<Access::Read>();
+            trace.acquired();
             return handler(std::index_sequence_for<Ts...>{});
         }
 
@@ -58,10 +85,14 @@ namespace spp
          * @brief Access all the Sync object's values in a read-write context.
          *
          * @param fn The function to call with the value.
+         * @param site The call site recorded by tracing and the watchdog, when compiled in.
          *
          * @return The return value of the function.
          */
-        [[nodiscard]] decltype(auto) write(std::invocable<Value<Ts>&...> auto&& fn) const
+        [[nodiscard]] decltype(auto) write(
+            std::invocable<Value<Ts>&...> auto&& fn,
+            detail::CallSite                     site = detail::CallSite::current()
+        ) const
             requires (not std::is_const_v<Ts> and ...)
         {
             auto handler = [&]<std::size_t... Is>(std::index_sequence<Is...>) -> decltype(auto) {
@@ -74,7 +105,10 @@ namespace spp
                 "instead."
             );
 
-            auto locks = lock_write();
+            auto notify = notify_written<Access::Write>();
+            auto trace  = trace_locks(site, false);
+            auto locks  = lock_all<Access::Write>();
+            trace.acquired();
             return handler(std::index_sequence_for<Ts...>{});
         }
 
@@ -83,29 +117,15 @@ namespace spp
          * constness of its Sync.
          *
          * @param fn The function to call with the value.
+         * @param site The call site recorded by tracing and the watchdog, when compiled in.
          *
          * @return The return value of the function.
          */
-        [[nodiscard]] decltype(auto) lock(std::invocable<Value<Ts>&...> auto&& fn) const
-        {
-            auto lock_all = [&]<std::size_t... Is>(std::index_sequence<Is...>) {
-                auto lock_read = []<typename M>(M& mutex) {
-                    if constexpr (std::derived_from<M, std::shared_mutex>) {
-                        return std::shared_lock{ mutex };
-                    } else {
-                        return std::unique_lock{ mutex };
-                    }
-                };
-                auto lock = [&]<typename T>(T& sync) {
-                    if constexpr (std::is_const_v<T>) {
-                        return lock_read(sync.mutex());
-                    } else {
-                        return std::unique_lock{ sync.mutex() };
-                    }
-                };
-                return std::tuple{ lock(std::get<Is>(m_syncs))... };
-            };
-
+        [[nodiscard]] decltype(auto) lock(
+            std::invocable<Value<Ts>&...> auto&& fn,
+            detail::CallSite                     site = detail::CallSite::current()
+        ) const
+        {
             auto handler = [&]<std::size_t... Is>(std::index_sequence<Is...>) -> decltype(auto) {
                 return std::forward<decltype(fn)>(fn)(std::get<Is>(m_syncs).m_value...);
             };
@@ -116,37 +136,300 @@ namespace spp
                 "instead."
             );
 
-            auto locks = lock_all(std::index_sequence_for<Ts...>{});
+            auto notify = notify_written<Access::Const>();
+            auto trace  = trace_locks(site, (std::is_const_v<Ts> and ...));
+            auto locks  = lock_all<Access::Const>();
+            trace.acquired();
             return handler(std::index_sequence_for<Ts...>{});
         }
 
+        /**
+         * @brief Access all the Sync object's values in a read-only context, only if every lock is free now.
+         *
+         * Either every lock is acquired or none.
+         *
+         * @param fn The function to call with the value.
+         *
+         * @return The return value of the function (or true if it returns void), empty if a lock is busy.
+         */
+        [[nodiscard]] auto try_read(std::invocable<const Value<Ts>&...> auto&& fn) const
+        {
+            return invoke_locked<Access::Read>(std::forward<decltype(fn)>(fn), std::try_to_lock);
+        }
+
+        /**
+         * @brief Access all the Sync object's values in a read-write context, only if every lock is free now.
+         *
+         * Either every lock is acquired or none.
+         *
+         * @param fn The function to call with the value.
+         *
+         * @return The return value of the function (or true if it returns void), empty if a lock is busy.
+         */
+        [[nodiscard]] auto try_write(std::invocable<Value<Ts>&...> auto&& fn) const
+            requires (not std::is_const_v<Ts> and ...)
+        {
+            return invoke_locked<Access::Write>(std::forward<decltype(fn)>(fn), std::try_to_lock);
+        }
+
+        /**
+         * @brief Same as lock(fn), only if every lock is free now.
+         *
+         * @param fn The function to call with the value.
+         *
+         * @return The return value of the function (or true if it returns void), empty if a lock is busy.
+         */
+        [[nodiscard]] auto try_lock(std::invocable<Value<Ts>&...> auto&& fn) const
+        {
+            return invoke_locked<Access::Const>(std::forward<decltype(fn)>(fn), std::try_to_lock);
+        }
+
+        /**
+         * @brief Access all the Sync object's values in a read-only context, give up after a timeout.
+         *
+         * @param timeout The maximum time to wait for all the locks.
+         * @param fn The function to call with the value.
+         *
+         * @return The return value of the function (or true if it returns void), empty on timeout.
+         */
+        template <typename Rep, typename Period>
+        [[nodiscard]] auto read_for(
+            const std::chrono::duration<Rep, Period>& timeout,
+            std::invocable<const Value<Ts>&...> auto&& fn
+        ) const
+        {
+            return read_until(std::chrono::steady_clock::now() + timeout, std::forward<decltype(fn)>(fn));
+        }
+
+        /**
+         * @brief Access all the Sync object's values in a read-only context, give up at a deadline.
+         *
+         * @param deadline The time point after which to stop waiting for the locks.
+         * @param fn The function to call with the value.
+         *
+         * @return The return value of the function (or true if it returns void), empty on timeout.
+         */
+        template <typename Clock, typename Duration>
+        [[nodiscard]] auto read_until(
+            const std::chrono::time_point<Clock, Duration>& deadline,
+            std::invocable<const Value<Ts>&...> auto&&       fn
+        ) const
+        {
+            auto steady = detail::to_steady(deadline);
+            return invoke_locked<Access::Read>(std::forward<decltype(fn)>(fn), steady);
+        }
+
+        /**
+         * @brief Access all the Sync object's values in a read-write context, give up after a timeout.
+         *
+         * @param timeout The maximum time to wait for all the locks.
+         * @param fn The function to call with the value.
+         *
+         * @return The return value of the function (or true if it returns void), empty on timeout.
+         */
+        template <typename Rep, typename Period>
+        [[nodiscard]] auto write_for(
+            const std::chrono::duration<Rep, Period>& timeout,
+            std::invocable<Value<Ts>&...> auto&&      fn
+        ) const
+            requires (not std::is_const_v<Ts> and ...)
+        {
+            return write_until(std::chrono::steady_clock::now() + timeout, std::forward<decltype(fn)>(fn));
+        }
+
+        /**
+         * @brief Access all the Sync object's values in a read-write context, give up at a deadline.
+         *
+         * @param deadline The time point after which to stop waiting for the locks.
+         * @param fn The function to call with the value.
+         *
+         * @return The return value of the function (or true if it returns void), empty on timeout.
+         */
+        template <typename Clock, typename Duration>
+        [[nodiscard]] auto write_until(
+            const std::chrono::time_point<Clock, Duration>& deadline,
+            std::invocable<Value<Ts>&...> auto&&            fn
+        ) const
+            requires (not std::is_const_v<Ts> and ...)
+        {
+            auto steady = detail::to_steady(deadline);
+            return invoke_locked<Access::Write>(std::forward<decltype(fn)>(fn), steady);
+        }
+
+        /**
+         * @brief Same as lock(fn), give up after a timeout.
+         *
+         * @param timeout The maximum time to wait for all the locks.
+         * @param fn The function to call with the value.
+         *
+         * @return The return value of the function (or true if it returns void), empty on timeout.
+         */
+        template <typename Rep, typename Period>
+        [[nodiscard]] auto lock_for(
+            const std::chrono::duration<Rep, Period>& timeout,
+            std::invocable<Value<Ts>&...> auto&&      fn
+        ) const
+        {
+            return lock_until(std::chrono::steady_clock::now() + timeout, std::forward<decltype(fn)>(fn));
+        }
+
+        /**
+         * @brief Same as lock(fn), give up at a deadline.
+         *
+         * @param deadline The time point after which to stop waiting for the locks.
+         * @param fn The function to call with the value.
+         *
+         * @return The return value of the function (or true if it returns void), empty on timeout.
+         */
+        template <typename Clock, typename Duration>
+        [[nodiscard]] auto lock_until(
+            const std::chrono::time_point<Clock, Duration>& deadline,
+            std::invocable<Value<Ts>&...> auto&&            fn
+        ) const
+        {
+            auto steady = detail::to_steady(deadline);
+            return invoke_locked<Access::Const>(std::forward<decltype(fn)>(fn), steady);
+        }
+
+        /**
+         * @brief Access all the Sync object's values in a read-only context, give up on a stop request.
+         *
+         * @param token The stop token to abandon the wait with.
+         * @param fn The function to call with the value.
+         *
+         * @return The return value of the function (or true if it returns void), empty if stopped.
+         */
+        [[nodiscard]] auto read(std::stop_token token, std::invocable<const Value<Ts>&...> auto&& fn) const
+        {
+            return invoke_locked<Access::Read>(std::forward<decltype(fn)>(fn), token);
+        }
+
+        /**
+         * @brief Access all the Sync object's values in a read-write context, give up on a stop request.
+         *
+         * @param token The stop token to abandon the wait with.
+         * @param fn The function to call with the value.
+         *
+         * @return The return value of the function (or true if it returns void), empty if stopped.
+         */
+        [[nodiscard]] auto write(std::stop_token token, std::invocable<Value<Ts>&...> auto&& fn) const
+            requires (not std::is_const_v<Ts> and ...)
+        {
+            return invoke_locked<Access::Write>(std::forward<decltype(fn)>(fn), token);
+        }
+
+        /**
+         * @brief Same as lock(fn), give up on a stop request.
+         *
+         * @param token The stop token to abandon the wait with.
+         * @param fn The function to call with the value.
+         *
+         * @return The return value of the function (or true if it returns void), empty if stopped.
+         */
+        [[nodiscard]] auto lock(std::stop_token token, std::invocable<Value<Ts>&...> auto&& fn) const
+        {
+            return invoke_locked<Access::Const>(std::forward<decltype(fn)>(fn), token);
+        }
+
     private:
-        Group(std::tuple<Ts&...> syncs)
+        enum class Access
+        {
+            Read,
+            Write,
+            Const,    // read or write depending on the constness of each Sync
+        };
+
+        using FirstMutex = typename std::tuple_element_t<0, std::tuple<Ts...>>::Mutex;
+
+        // mutexes of the same type locked in address order are called directly, the others type-erased
+        static constexpr bool typed_locks = std::same_as<Policy, lock_policy::Ordered>
+                                        and (std::same_as<typename Ts::Mutex, FirstMutex> and ...);
+
+        using Locks = std::conditional_t<
+            typed_locks,
+            detail::OrderedLocks<FirstMutex, sizeof...(Ts)>,
+            detail::LockSet<sizeof...(Ts), Policy>>;
+
+        using Request = typename Locks::Requests::value_type;
+
+        BasicGroup(std::tuple<Ts&...> syncs)
             : m_syncs{ std::move(syncs) }
         {
         }
 
-        [[nodiscard]] auto lock_read() const
+        template <Access A, typename T>
+        static Request request(T& sync)
         {
-            auto lock = []<typename M>(M& mutex) {
-                if constexpr (std::derived_from<M, std::shared_mutex>) {
-                    return std::shared_lock{ mutex };
-                } else {
-                    return std::unique_lock{ mutex };
-                }
-            };
-            auto handler = [&]<std::size_t... Is>(std::index_sequence<Is...>) {
-                return std::tuple{ lock(std::get<Is>(m_syncs).mutex())... };
-            };
-            return handler(std::index_sequence_for<Ts...>{});
+            constexpr auto shared = A == Access::Read or (A == Access::Const and std::is_const_v<T>);
+            return { sync.mutex(), shared ? detail::LockMode::Shared : detail::LockMode::Exclusive };
+        }
+
+        template <Access A>
+        typename Locks::Requests requests() const
+        {
+            return std::apply(
+                [](auto&... syncs) { return typename Locks::Requests{ request<A>(syncs)... }; },
+                m_syncs
+            );
+        }
+
+        // block until every lock is acquired
+        template <Access A>
+        [[nodiscard]] Locks lock_all() const
+        {
+            return Locks{ requests<A>() };
+        }
+
+        // the address the waiters of an object wait on (see Sync::wait_read), nullptr if it's not written
+        template <Access A, typename T>
+        static const void* written(T& sync)
+        {
+            constexpr auto shared = A == Access::Read or (A == Access::Const and std::is_const_v<T>);
+            return shared ? nullptr : &sync.m_value;
+        }
+
+        // declared before the locks, so that the waiters and subscribers of the written objects are notified
+        // after unlocking
+        template <Access A>
+        [[nodiscard]] detail::NotifyScope<sizeof...(Ts)> notify_written() const
+        {
+            using Scope = detail::NotifyScope<sizeof...(Ts)>;
+            return std::apply(
+                [](auto&... syncs) { return Scope{ typename Scope::Addresses{ written<A>(syncs)... } }; },
+                m_syncs
+            );
+        }
+
+        // recorded as a single lock of the first object's mutex, declared before the locks
+        [[nodiscard]] detail::TraceScope trace_locks(const detail::CallSite& site, bool shared) const
+        {
+            return { site, &std::get<0>(m_syncs).mutex(), shared, sizeof...(Ts) };
         }
 
-        [[nodiscard]] auto lock_write() const
+        // acquire every lock with the given strategy (all or nothing), then call fn if it succeeded
+        template <Access A>
+        auto invoke_locked(auto&& fn, const auto& strategy) const
         {
-            auto handler = [&]<std::size_t... Is>(std::index_sequence<Is...>) {
-                return std::tuple{ std::unique_lock{ std::get<Is>(m_syncs).mutex() }... };
+            auto handler = [&](auto&... syncs) {
+                auto notify = notify_written<A>();
+                auto locks  = Locks{ requests<A>(), strategy };
+
+                using Ret    = std::invoke_result_t<decltype(fn), decltype((syncs.m_value))...>;
+                using Result = detail::OptionalResult<Ret>;
+
+                static_assert(
+                    not std::is_lvalue_reference_v<Ret>,
+                    "Function returning a reference in multithreaded context is dangerous! Consider copying "
+                    "instead."
+                );
+
+                if (not locks.owns_lock()) {
+                    notify.dismiss();
+                    return Result{};
+                }
+                return detail::invoke_optional(std::forward<decltype(fn)>(fn), syncs.m_value...);
             };
-            return handler(std::index_sequence_for<Ts...>{});
+            return std::apply(handler, m_syncs);
         }
 
         std::tuple<Ts&...> m_syncs;
@@ -155,19 +438,17 @@ namespace spp
     /**
      * @brief Make a group of Sync objects.
      *
+     * @tparam Policy How to wait for the locks (see spp::lock_policy), e.g. spp::group<Park>(a, b).
      * @tparam Ts The Sync objects actual types (derived from spp::Sync).
      *
      * @param syncs The Sync objects to group
      *
      * @return A Group object containing the Sync objects.
-     *
-     * TODO: add constraints to Ts
-     *
      */
-    template <concepts::SyncDerivative... Ts>
-    Group<Ts...> group(Ts&... syncs)
+    template <concepts::LockPolicy Policy, concepts::SyncDerivative... Ts>
+    BasicGroup<Policy, Ts...> group(Ts&... syncs)
     {
-        return Group<Ts...>{ std::tie(syncs...) };
+        return BasicGroup<Policy, Ts...>{ std::tie(syncs...) };
     }
 }
 
@@ -0,0 +1,78 @@
+#ifndef SYNC_CPP_LOCK_POLICY_HPP_H7TN2QXE
+#define SYNC_CPP_LOCK_POLICY_HPP_H7TN2QXE
+
+#include "sync_cpp/concepts.hpp"
+#include "sync_cpp/mutex/backoff.hpp"
+
+#include <concepts>
+
+/**
+ * @brief Policies for acquiring several locks at once (see spp::group).
+ *
+ * Each of them is deadlock-free whatever the order the objects are given in, they differ in how a thread
+ * waits while one of the locks is busy.
+ */
+namespace spp::lock_policy
+{
+    /**
+     * @class Ordered
+     *
+     * @brief Block on every mutex in turn, in address order (the default).
+     *
+     * Every group locks in the same global order, so no two groups wait for each other. The cheapest when
+     * the locks are rarely contended; a waiter may hold the first locks while it waits for the last one.
+     */
+    struct Ordered
+    {
+    };
+
+    /**
+     * @class Park
+     *
+     * @brief Block on one mutex, only try the others; when one is busy release everything and park on that
+     * one next (like std::lock).
+     *
+     * A waiter holds nothing while it sleeps, so it never stalls the users of the locks that are free.
+     */
+    struct Park
+    {
+        using Wait = backoff::Yield;    // between releasing everything and parking on the busy mutex
+    };
+
+    /**
+     * @class Backoff
+     *
+     * @brief Only try every mutex; when one is busy release everything and wait with the backoff policy B
+     * before the next attempt. Never sleeps in a mutex.
+     *
+     * Use backoff::Exponential to spin, backoff::Yield to yield, backoff::SpinThenSleep for long waits.
+     *
+     * @tparam B The backoff policy used between failed attempts.
+     */
+    template <concepts::Backoff B = backoff::SpinThenYield<>>
+    struct Backoff
+    {
+        using Wait = B;
+    };
+}
+
+namespace spp::detail
+{
+    template <typename T>
+    inline constexpr bool is_backoff_policy = false;
+
+    template <typename B>
+    inline constexpr bool is_backoff_policy<lock_policy::Backoff<B>> = true;
+}
+
+namespace spp::concepts
+{
+    /**
+     * @brief One of the policies in spp::lock_policy.
+     */
+    template <typename T>
+    concept LockPolicy = std::same_as<T, lock_policy::Ordered> or std::same_as<T, lock_policy::Park>
+                      or detail::is_backoff_policy<T>;
+}
+
+#endif /* end of include guard: SYNC_CPP_LOCK_POLICY_HPP_H7TN2QXE */
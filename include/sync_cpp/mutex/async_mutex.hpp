@@ -0,0 +1,234 @@
+#ifndef SYNC_CPP_MUTEX_ASYNC_MUTEX_HPP_M5TJ0Q3B
+#define SYNC_CPP_MUTEX_ASYNC_MUTEX_HPP_M5TJ0Q3B
+
+#include "sync_cpp/mutex/spin_lock.hpp"
+
+#include <coroutine>
+#include <functional>
+#include <mutex>
+#include <utility>
+
+namespace spp
+{
+    /**
+     * @class AsyncSharedMutex
+     *
+     * @brief A shared mutex for coroutines: waiting suspends the coroutine instead of blocking its thread.
+     *
+     * `co_await mutex.lock_async()` (or `lock_shared_async()`) returns once the lock is held. A coroutine
+     * that can't get it is queued, in FIFO order, and the thread goes back to its executor. On release the
+     * lock is handed over directly to the first waiter, or to every reader at the front of the queue at once,
+     * and the new holders are resumed: inline by the releasing thread, or through the executor given to the
+     * mutex. A reader arriving while a waiter is queued queues behind it, so writers don't starve.
+     *
+     * Inline, a release made by a resumed coroutine doesn't resume the next holders from within it: they're
+     * queued for the outermost release of the thread, which resumes them in a loop once the coroutine has
+     * suspended or finished. So a long queue of waiters doesn't grow the stack.
+     *
+     * A suspended coroutine must not be destroyed before it is resumed.
+     */
+    class AsyncSharedMutex
+    {
+    private:
+        // lives in the awaiter, in the frame of the suspended coroutine
+        struct Waiter
+        {
+            bool                    m_shared = false;
+            std::coroutine_handle<> m_handle = nullptr;
+            Waiter*                 m_next   = nullptr;
+        };
+
+    public:
+        /**
+         * @brief Resumes a coroutine that got the lock, e.g. by posting it to a thread pool.
+         */
+        using Executor = std::function<void(std::coroutine_handle<>)>;
+
+        /**
+         * @class Awaiter
+         *
+         * @brief The awaitable returned by lock_async() and lock_shared_async(), holds the lock once resumed.
+         */
+        class [[nodiscard]] Awaiter
+        {
+        public:
+            Awaiter(const Awaiter&)            = delete;
+            Awaiter& operator=(const Awaiter&) = delete;
+
+            bool await_ready() { return m_waiter.m_shared ? m_mutex.try_lock_shared() : m_mutex.try_lock(); }
+
+            bool await_suspend(std::coroutine_handle<> handle)
+            {
+                m_waiter.m_handle = handle;
+                return m_mutex.enqueue(m_waiter);
+            }
+
+            void await_resume() const noexcept {}
+
+        private:
+            friend AsyncSharedMutex;
+
+            Awaiter(AsyncSharedMutex& mutex, bool shared)
+                : m_mutex{ mutex }
+                , m_waiter{ .m_shared = shared }
+            {
+            }
+
+            AsyncSharedMutex& m_mutex;
+            Waiter            m_waiter;
+        };
+
+        AsyncSharedMutex() = default;
+
+        explicit AsyncSharedMutex(Executor executor)
+            : m_executor{ std::move(executor) }
+        {
+        }
+
+        AsyncSharedMutex(const AsyncSharedMutex&)            = delete;
+        AsyncSharedMutex& operator=(const AsyncSharedMutex&) = delete;
+
+        Awaiter lock_async() { return Awaiter{ *this, false }; }
+        Awaiter lock_shared_async() { return Awaiter{ *this, true }; }
+
+        bool try_lock()
+        {
+            auto guard = std::lock_guard{ m_guard };
+            return acquire(false);
+        }
+
+        bool try_lock_shared()
+        {
+            auto guard = std::lock_guard{ m_guard };
+            return acquire(true);
+        }
+
+        void unlock()
+        {
+            auto guard = std::unique_lock{ m_guard };
+            m_state    = 0;
+            hand_over(guard);
+        }
+
+        void unlock_shared()
+        {
+            auto guard = std::unique_lock{ m_guard };
+            if (--m_state == 0) {
+                hand_over(guard);
+            }
+        }
+
+    private:
+        static constexpr int exclusive = -1;
+
+        // the guard is held, a newcomer gets the lock only if nobody is queued
+        bool acquire(bool shared)
+        {
+            if (m_head != nullptr or m_state == exclusive or (not shared and m_state != 0)) {
+                return false;
+            }
+            m_state = shared ? m_state + 1 : exclusive;
+            return true;
+        }
+
+        // returns false if the lock was acquired after all and the coroutine should not suspend
+        bool enqueue(Waiter& waiter)
+        {
+            auto guard = std::lock_guard{ m_guard };
+            if (acquire(waiter.m_shared)) {
+                return false;
+            }
+
+            (m_head == nullptr ? m_head : m_tail->m_next) = &waiter;
+            m_tail                                        = &waiter;
+            return true;
+        }
+
+        // the lock is free: give it to the first writer or to the readers at the front, then resume them
+        void hand_over(std::unique_lock<SpinLock<>>& guard)
+        {
+            auto* granted = m_head;
+            auto* last    = m_head;
+            if (granted == nullptr) {
+                return;
+            }
+
+            if (not granted->m_shared) {
+                m_state = exclusive;
+            } else {
+                m_state = 1;
+                while (last->m_next != nullptr and last->m_next->m_shared) {
+                    last = last->m_next;
+                    ++m_state;
+                }
+            }
+
+            m_head = last->m_next;
+            if (m_head == nullptr) {
+                m_tail = nullptr;
+            }
+            last->m_next = nullptr;
+            guard.unlock();
+
+            if (m_executor) {
+                // a resumed coroutine may destroy its waiter, so read the next one first
+                while (granted != nullptr) {
+                    auto* next = std::exchange(granted->m_next, nullptr);
+                    m_executor(granted->m_handle);
+                    granted = next;
+                }
+                return;
+            }
+
+            auto& pending = resumptions();
+            (pending.m_head == nullptr ? pending.m_head : pending.m_tail->m_next) = granted;
+            pending.m_tail                                                        = last;
+            if (pending.m_resuming) {
+                return;    // called from a resumed coroutine, the outermost release resumes them
+            }
+            resume_pending(pending);
+        }
+
+        // the holders granted the lock (of any mutex) on this thread that are yet to be resumed inline
+        struct Resumptions
+        {
+            bool    m_resuming = false;
+            Waiter* m_head     = nullptr;
+            Waiter* m_tail     = nullptr;
+        };
+
+        static Resumptions& resumptions()
+        {
+            thread_local auto t_resumptions = Resumptions{};
+            return t_resumptions;
+        }
+
+        static void resume_pending(Resumptions& pending)
+        {
+            pending.m_resuming = true;
+            try {
+                while (pending.m_head != nullptr) {
+                    // a resumed coroutine may destroy its waiter, so unlink it first
+                    auto* waiter   = pending.m_head;
+                    pending.m_head = std::exchange(waiter->m_next, nullptr);
+                    if (pending.m_head == nullptr) {
+                        pending.m_tail = nullptr;
+                    }
+                    waiter->m_handle.resume();
+                }
+            } catch (...) {
+                pending.m_resuming = false;
+                throw;
+            }
+            pending.m_resuming = false;
+        }
+
+        SpinLock<> m_guard;
+        int        m_state = 0;    // readers holding the lock, or exclusive
+        Waiter*    m_head  = nullptr;
+        Waiter*    m_tail  = nullptr;
+        Executor   m_executor;
+    };
+}
+
+#endif /* end of include guard: SYNC_CPP_MUTEX_ASYNC_MUTEX_HPP_M5TJ0Q3B */
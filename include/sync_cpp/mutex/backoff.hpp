@@ -0,0 +1,109 @@
+#ifndef SYNC_CPP_MUTEX_BACKOFF_HPP_3UQ9BW7D
+#define SYNC_CPP_MUTEX_BACKOFF_HPP_3UQ9BW7D
+
+#include "sync_cpp/detail/hardware.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+/**
+ * @brief Backoff policies for spinning waits.
+ *
+ * A backoff policy is created at the start of a wait and called once after every failed attempt.
+ */
+namespace spp::backoff
+{
+    /**
+     * @class Pause
+     *
+     * @brief Only hint the processor that we are spinning, retry immediately.
+     */
+    struct Pause
+    {
+        void operator()() noexcept { detail::cpu_relax(); }
+    };
+
+    /**
+     * @class Exponential
+     *
+     * @brief Spin for an exponentially growing number of pauses, capped at Max.
+     */
+    template <std::uint32_t Max = 1024>
+    class Exponential
+    {
+    public:
+        void operator()() noexcept
+        {
+            for (auto i = 0u; i < m_pauses; ++i) {
+                detail::cpu_relax();
+            }
+            m_pauses = std::min(m_pauses * 2, Max);
+        }
+
+    private:
+        std::uint32_t m_pauses = 1;
+    };
+
+    /**
+     * @class Yield
+     *
+     * @brief Give the rest of the time slice to other threads.
+     */
+    struct Yield
+    {
+        void operator()() noexcept { std::this_thread::yield(); }
+    };
+
+    /**
+     * @class SpinThenYield
+     *
+     * @brief Spin with exponential backoff for the first Spins attempts, then yield.
+     */
+    template <std::uint32_t Spins = 16, std::uint32_t Max = 1024>
+    class SpinThenYield
+    {
+    public:
+        void operator()() noexcept
+        {
+            if (m_attempts++ < Spins) {
+                m_spin();
+            } else {
+                std::this_thread::yield();
+            }
+        }
+
+    private:
+        std::uint32_t    m_attempts = 0;
+        Exponential<Max> m_spin;
+    };
+
+    /**
+     * @class SpinThenSleep
+     *
+     * @brief Spin with exponential backoff for the first Spins attempts, then sleep for an exponentially
+     * growing time, capped at MaxSleepUs microseconds. Meant for waits that may last long.
+     */
+    template <std::uint32_t Spins = 16, std::uint32_t MaxSleepUs = 1000>
+    class SpinThenSleep
+    {
+    public:
+        void operator()() noexcept
+        {
+            if (m_attempts++ < Spins) {
+                m_spin();
+            } else {
+                std::this_thread::sleep_for(std::chrono::microseconds{ m_sleep_us });
+                m_sleep_us = std::min(m_sleep_us * 2, MaxSleepUs);
+            }
+        }
+
+    private:
+        std::uint32_t m_attempts = 0;
+        std::uint32_t m_sleep_us = 1;
+        Exponential<> m_spin;
+    };
+}
+
+#endif /* end of include guard: SYNC_CPP_MUTEX_BACKOFF_HPP_3UQ9BW7D */
@@ -0,0 +1,141 @@
+#ifndef SYNC_CPP_MUTEX_BIG_READER_MUTEX_HPP_H3XS9KQ1
+#define SYNC_CPP_MUTEX_BIG_READER_MUTEX_HPP_H3XS9KQ1
+
+#include "sync_cpp/detail/hardware.hpp"
+#include "sync_cpp/detail/thread_index.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace spp
+{
+    /**
+     * @class BigReaderMutex
+     *
+     * @brief A shared mutex for data that is read all the time and written rarely, whose readers scale with
+     * the number of cores.
+     *
+     * Every reader announces itself in one of the per-thread slots (by thread index), each on its own cache
+     * line, so readers on different cores never touch the same line; a writer sets the writer flag, then
+     * scans the slots and waits for each to drain. A writer is expensive (Slots cache lines) and a waiting
+     * writer blocks new readers. Both sides spin briefly, then park on the word they wait for.
+     *
+     * A shared lock must be released by the thread that took it.
+     *
+     * @tparam Slots The number of reader slots, ideally at least the number of cores.
+     */
+    template <std::size_t Slots = 64>
+        requires (Slots > 0)
+    class BigReaderMutex
+    {
+    public:
+        BigReaderMutex() = default;
+
+        BigReaderMutex(const BigReaderMutex&)            = delete;
+        BigReaderMutex& operator=(const BigReaderMutex&) = delete;
+
+        void lock() noexcept
+        {
+            auto state = free;
+            while (not m_writer.m_value.compare_exchange_weak(state, held, std::memory_order_seq_cst)) {
+                if (state == held) {
+                    m_writer.m_value.wait(held, std::memory_order_relaxed);
+                }
+                state = free;
+            }
+
+            for (auto& slot : m_slots) {
+                wait_until(slot, 0);
+            }
+        }
+
+        bool try_lock() noexcept
+        {
+            auto state = free;
+            if (not m_writer.m_value.compare_exchange_strong(state, held, std::memory_order_seq_cst)) {
+                return false;
+            }
+
+            for (auto& slot : m_slots) {
+                if (slot.m_value.load(std::memory_order_seq_cst) != 0) {
+                    unlock();
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        void unlock() noexcept
+        {
+            m_writer.m_value.store(free, std::memory_order_release);
+            m_writer.m_value.notify_all();
+        }
+
+        void lock_shared() noexcept
+        {
+            auto& slot = own_slot();
+            while (not enter(slot)) {
+                wait_until(m_writer, free);
+            }
+        }
+
+        bool try_lock_shared() noexcept { return enter(own_slot()); }
+
+        void unlock_shared() noexcept { leave(own_slot()); }
+
+    private:
+        static constexpr std::uint32_t free       = 0;
+        static constexpr std::uint32_t held       = 1;
+        static constexpr int           spin_limit = 64;
+
+        // the reader count of a slot, or the writer flag
+        struct alignas(detail::cache_line_size) Word
+        {
+            std::atomic<std::uint32_t> m_value = 0;
+        };
+
+        Word& own_slot() noexcept { return m_slots[detail::thread_index() % Slots]; }
+
+        // the reader announces itself before looking for a writer, the writer does the opposite (both
+        // seq_cst), so at least one of them sees the other
+        bool enter(Word& slot) noexcept
+        {
+            slot.m_value.fetch_add(1, std::memory_order_seq_cst);
+            if (m_writer.m_value.load(std::memory_order_seq_cst) == free) {
+                return true;
+            }
+            leave(slot);
+            return false;
+        }
+
+        void leave(Word& slot) noexcept
+        {
+            slot.m_value.fetch_sub(1, std::memory_order_seq_cst);
+            if (m_writer.m_value.load(std::memory_order_seq_cst) != free) {
+                slot.m_value.notify_all();    // a writer may be waiting for this slot to drain
+            }
+        }
+
+        static void wait_until(Word& word, std::uint32_t expected) noexcept
+        {
+            for (auto spin = 0;; ++spin) {
+                auto value = word.m_value.load(std::memory_order_seq_cst);
+                if (value == expected) {
+                    return;
+                }
+                if (spin < spin_limit) {
+                    detail::cpu_relax();
+                } else {
+                    word.m_value.wait(value, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        Word                    m_writer;
+        std::array<Word, Slots> m_slots;
+    };
+}
+
+#endif /* end of include guard: SYNC_CPP_MUTEX_BIG_READER_MUTEX_HPP_H3XS9KQ1 */
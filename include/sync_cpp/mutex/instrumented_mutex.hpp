@@ -0,0 +1,310 @@
+#ifndef SYNC_CPP_MUTEX_INSTRUMENTED_MUTEX_HPP_H1QS7LVB
+#define SYNC_CPP_MUTEX_INSTRUMENTED_MUTEX_HPP_H1QS7LVB
+
+#include "sync_cpp/concepts.hpp"
+#include "sync_cpp/detail/hardware.hpp"
+#include "sync_cpp/detail/thread_index.hpp"
+#include "sync_cpp/stats.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace spp
+{
+    /**
+     * @class InstrumentedMutex
+     *
+     * @brief A mutex adapter that records acquisition statistics of the wrapped mutex.
+     *
+     * Records the number of acquisitions, how many of them had to wait, and histograms of the wait and hold
+     * times, for shared and exclusive locks separately. Every thread records into one of a few cache-line
+     * aligned shards with relaxed atomics, so recording never takes a lock and rarely shares a cache line
+     * with another thread. An uncontended acquisition costs a try_lock and two clock reads on top of the
+     * wrapped mutex. The statistics are allocated next to it: about 10 KB per shard (four histograms), about
+     * 40 KB per mutex with the default 4 shards, so instrument the objects under investigation rather than
+     * every object of a large population.
+     *
+     * The wrapped mutex's capabilities are forwarded: it's SharedLockable and/or TimedLockable if M is. With
+     * a recursive mutex, an exclusive hold lasts from the outermost lock to the matching unlock.
+     *
+     * @tparam M The wrapped mutex type.
+     * @tparam Shards The number of statistics shards threads are spread over.
+     */
+    template <concepts::Lockable M = std::mutex, std::size_t Shards = 4>
+        requires (Shards > 0)
+    class InstrumentedMutex
+    {
+    public:
+        using Mutex = M;
+        using Clock = std::chrono::steady_clock;
+
+        InstrumentedMutex()
+            : m_shards{ std::make_unique<Shard[]>(Shards) }
+        {
+        }
+
+        InstrumentedMutex(const InstrumentedMutex&)            = delete;
+        InstrumentedMutex& operator=(const InstrumentedMutex&) = delete;
+
+        void lock()
+        {
+            if (m_mutex.try_lock()) {
+                acquired(shard().m_exclusive, Clock::time_point{});
+            } else {
+                auto start = Clock::now();
+                m_mutex.lock();
+                acquired(shard().m_exclusive, start);
+            }
+            hold();
+        }
+
+        bool try_lock()
+        {
+            if (not m_mutex.try_lock()) {
+                return false;
+            }
+            acquired(shard().m_exclusive, Clock::time_point{});
+            hold();
+            return true;
+        }
+
+        template <typename Rep, typename Period>
+            requires concepts::TimedLockable<M>
+        bool try_lock_for(const std::chrono::duration<Rep, Period>& timeout)
+        {
+            return try_lock_until(Clock::now() + timeout);
+        }
+
+        template <typename C, typename Duration>
+            requires concepts::TimedLockable<M>
+        bool try_lock_until(const std::chrono::time_point<C, Duration>& deadline)
+        {
+            if (not m_mutex.try_lock()) {
+                auto start = Clock::now();
+                if (not m_mutex.try_lock_until(deadline)) {
+                    return false;
+                }
+                acquired(shard().m_exclusive, start);
+            } else {
+                acquired(shard().m_exclusive, Clock::time_point{});
+            }
+            hold();
+            return true;
+        }
+
+        void unlock()
+        {
+            if (--m_depth > 0) {
+                m_mutex.unlock();    // a nested hold of a recursive mutex, the outermost one is recorded
+                return;
+            }
+            auto held = Clock::now() - m_hold_start;
+            m_mutex.unlock();
+            shard().m_exclusive.m_hold.record(nanoseconds(held));
+        }
+
+        void lock_shared()
+            requires concepts::SharedLockable<M>
+        {
+            if (m_mutex.try_lock_shared()) {
+                acquired(shard().m_shared, Clock::time_point{});
+            } else {
+                auto start = Clock::now();
+                m_mutex.lock_shared();
+                acquired(shard().m_shared, start);
+            }
+            SharedHolds::local().push(this, Clock::now());
+        }
+
+        bool try_lock_shared()
+            requires concepts::SharedLockable<M>
+        {
+            if (not m_mutex.try_lock_shared()) {
+                return false;
+            }
+            acquired(shard().m_shared, Clock::time_point{});
+            SharedHolds::local().push(this, Clock::now());
+            return true;
+        }
+
+        template <typename Rep, typename Period>
+            requires concepts::SharedTimedLockable<M>
+        bool try_lock_shared_for(const std::chrono::duration<Rep, Period>& timeout)
+        {
+            return try_lock_shared_until(Clock::now() + timeout);
+        }
+
+        template <typename C, typename Duration>
+            requires concepts::SharedTimedLockable<M>
+        bool try_lock_shared_until(const std::chrono::time_point<C, Duration>& deadline)
+        {
+            if (not m_mutex.try_lock_shared()) {
+                auto start = Clock::now();
+                if (not m_mutex.try_lock_shared_until(deadline)) {
+                    return false;
+                }
+                acquired(shard().m_shared, start);
+            } else {
+                acquired(shard().m_shared, Clock::time_point{});
+            }
+            SharedHolds::local().push(this, Clock::now());
+            return true;
+        }
+
+        void unlock_shared()
+            requires concepts::SharedLockable<M>
+        {
+            auto start = SharedHolds::local().pop(this);
+            m_mutex.unlock_shared();
+            if (start != Clock::time_point{}) {
+                shard().m_shared.m_hold.record(nanoseconds(Clock::now() - start));
+            }
+        }
+
+        /**
+         * @brief Get a snapshot of the statistics.
+         *
+         * Every counter is read atomically, but the snapshot as a whole is not: acquisitions that happen
+         * while it is taken may be partially included.
+         */
+        [[nodiscard]] MutexStats stats() const
+        {
+            auto stats = MutexStats{};
+            for (auto i = 0u; i < Shards; ++i) {
+                m_shards[i].m_exclusive.add_to(stats.m_exclusive);
+                m_shards[i].m_shared.add_to(stats.m_shared);
+            }
+            return stats;
+        }
+
+        /**
+         * @brief Reset every statistic to zero.
+         */
+        void reset_stats() noexcept
+        {
+            for (auto i = 0u; i < Shards; ++i) {
+                m_shards[i].m_exclusive.reset();
+                m_shards[i].m_shared.reset();
+            }
+        }
+
+        /**
+         * @brief Get the wrapped mutex.
+         */
+        M& underlying() noexcept { return m_mutex; }
+
+    private:
+        struct Recorder
+        {
+            std::atomic<std::uint64_t> m_acquisitions = 0;
+            std::atomic<std::uint64_t> m_contended    = 0;
+            detail::AtomicHistogram    m_wait;
+            detail::AtomicHistogram    m_hold;
+
+            void add_to(LockStats& stats) const noexcept
+            {
+                stats.m_acquisitions += m_acquisitions.load(std::memory_order_relaxed);
+                stats.m_contended    += m_contended.load(std::memory_order_relaxed);
+                m_wait.add_to(stats.m_wait);
+                m_hold.add_to(stats.m_hold);
+            }
+
+            void reset() noexcept
+            {
+                m_acquisitions.store(0, std::memory_order_relaxed);
+                m_contended.store(0, std::memory_order_relaxed);
+                m_wait.reset();
+                m_hold.reset();
+            }
+        };
+
+        struct alignas(detail::cache_line_size) Shard
+        {
+            Recorder m_exclusive;
+            Recorder m_shared;
+        };
+
+        // the start of the shared holds of the calling thread, a thread may hold many shared locks at once
+        class SharedHolds
+        {
+        public:
+            static SharedHolds& local() noexcept
+            {
+                thread_local auto t_holds = SharedHolds{};
+                return t_holds;
+            }
+
+            void push(const void* mutex, Clock::time_point start) noexcept
+            {
+                if (m_count < capacity) {
+                    m_holds[m_count++] = { mutex, start };
+                }
+            }
+
+            // holds that didn't fit (or were released by another thread) are not recorded
+            Clock::time_point pop(const void* mutex) noexcept
+            {
+                for (auto i = m_count; i > 0; --i) {
+                    if (m_holds[i - 1].m_mutex == mutex) {
+                        auto start     = m_holds[i - 1].m_start;
+                        m_holds[i - 1] = m_holds[--m_count];
+                        return start;
+                    }
+                }
+                return {};
+            }
+
+        private:
+            struct Hold
+            {
+                const void*       m_mutex;
+                Clock::time_point m_start;
+            };
+
+            static constexpr std::size_t capacity = 16;
+
+            std::array<Hold, capacity> m_holds = {};
+            std::size_t                m_count = 0;
+        };
+
+        static std::uint64_t nanoseconds(Clock::duration duration) noexcept
+        {
+            auto count = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+            return count > 0 ? static_cast<std::uint64_t>(count) : 0;
+        }
+
+        // a default constructed start means the acquisition didn't wait
+        static void acquired(Recorder& recorder, Clock::time_point start) noexcept
+        {
+            recorder.m_acquisitions.fetch_add(1, std::memory_order_relaxed);
+            if (start == Clock::time_point{}) {
+                recorder.m_wait.record(0);
+            } else {
+                recorder.m_contended.fetch_add(1, std::memory_order_relaxed);
+                recorder.m_wait.record(nanoseconds(Clock::now() - start));
+            }
+        }
+
+        // called once the exclusive lock is held, only the owner touches the hold
+        void hold() noexcept
+        {
+            if (m_depth++ == 0) {
+                m_hold_start = Clock::now();
+            }
+        }
+
+        Shard& shard() const noexcept { return m_shards[detail::thread_index() % Shards]; }
+
+        M                        m_mutex;
+        Clock::time_point        m_hold_start;
+        std::size_t              m_depth = 0;    // of the exclusive hold, above 1 only for a recursive mutex
+        std::unique_ptr<Shard[]> m_shards;
+    };
+}
+
+#endif /* end of include guard: SYNC_CPP_MUTEX_INSTRUMENTED_MUTEX_HPP_H1QS7LVB */
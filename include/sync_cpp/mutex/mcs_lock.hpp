@@ -0,0 +1,136 @@
+#ifndef SYNC_CPP_MUTEX_MCS_LOCK_HPP_Z7PB5C0J
+#define SYNC_CPP_MUTEX_MCS_LOCK_HPP_Z7PB5C0J
+
+#include "sync_cpp/concepts.hpp"
+#include "sync_cpp/detail/hardware.hpp"
+#include "sync_cpp/mutex/backoff.hpp"
+
+#include <atomic>
+#include <utility>
+
+namespace spp
+{
+    /**
+     * @class McsLock
+     *
+     * @brief A FIFO queue spinlock (Mellor-Crummey and Scott).
+     *
+     * Each waiter enqueues its own node and spins on a flag inside that node, so under contention every
+     * waiter spins on its own cache line and the lock is handed over with a single cache line transfer.
+     *
+     * The queue nodes come from a per-thread pool, so the lock can be used through the plain Lockable
+     * interface (a thread may hold any number of McsLock at once).
+     *
+     * @tparam B The backoff policy used while waiting for the predecessor to hand over the lock.
+     */
+    template <concepts::Backoff B = backoff::Pause>
+    class McsLock
+    {
+    public:
+        McsLock() = default;
+
+        McsLock(const McsLock&)            = delete;
+        McsLock& operator=(const McsLock&) = delete;
+
+        void lock()
+        {
+            auto* node = acquire_node();
+            if (auto* prev = m_tail.exchange(node, std::memory_order_acq_rel); prev != nullptr) {
+                prev->m_next.store(node, std::memory_order_release);
+
+                auto backoff = B{};
+                while (node->m_waiting.load(std::memory_order_acquire)) {
+                    backoff();
+                }
+            }
+            m_owner = node;
+        }
+
+        bool try_lock()
+        {
+            auto* node     = acquire_node();
+            auto* expected = static_cast<Node*>(nullptr);
+            if (m_tail.compare_exchange_strong(expected, node, std::memory_order_acquire)) {
+                m_owner = node;
+                return true;
+            }
+            release_node(node);
+            return false;
+        }
+
+        void unlock() noexcept
+        {
+            auto* node = m_owner;
+            auto* next = node->m_next.load(std::memory_order_acquire);
+
+            if (next == nullptr) {
+                auto* expected = node;
+                if (m_tail.compare_exchange_strong(expected, nullptr, std::memory_order_release)) {
+                    release_node(node);
+                    return;
+                }
+
+                // a successor is enqueueing itself, wait for the link
+                while ((next = node->m_next.load(std::memory_order_acquire)) == nullptr) {
+                    detail::cpu_relax();
+                }
+            }
+
+            next->m_waiting.store(false, std::memory_order_release);
+            release_node(node);
+        }
+
+    private:
+        struct alignas(detail::cache_line_size) Node
+        {
+            std::atomic<Node*> m_next    = nullptr;
+            std::atomic<bool>  m_waiting = true;
+            Node*              m_free    = nullptr;
+        };
+
+        struct NodePool
+        {
+            Node* m_head = nullptr;
+
+            ~NodePool()
+            {
+                while (m_head != nullptr) {
+                    delete std::exchange(m_head, m_head->m_free);
+                }
+            }
+        };
+
+        static NodePool& pool() noexcept
+        {
+            thread_local auto t_pool = NodePool{};
+            return t_pool;
+        }
+
+        static Node* acquire_node()
+        {
+            auto& pool = McsLock::pool();
+            auto* node = pool.m_head;
+            if (node != nullptr) {
+                pool.m_head = node->m_free;
+            } else {
+                node = new Node{};
+            }
+
+            node->m_next.store(nullptr, std::memory_order_relaxed);
+            node->m_waiting.store(true, std::memory_order_relaxed);
+            return node;
+        }
+
+        static void release_node(Node* node) noexcept
+        {
+            auto& pool   = McsLock::pool();
+            node->m_free = pool.m_head;
+            pool.m_head  = node;
+        }
+
+        std::atomic<Node*> m_tail  = nullptr;
+        Node*              m_owner = nullptr;    // only accessed by the thread holding the lock
+    };
+}
+
+#endif /* end of include guard: SYNC_CPP_MUTEX_MCS_LOCK_HPP_Z7PB5C0J */
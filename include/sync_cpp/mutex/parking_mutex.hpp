@@ -0,0 +1,355 @@
+#ifndef SYNC_CPP_MUTEX_PARKING_MUTEX_HPP_K0FD3QX7
+#define SYNC_CPP_MUTEX_PARKING_MUTEX_HPP_K0FD3QX7
+
+#include "sync_cpp/detail/hardware.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace spp
+{
+    /**
+     * @class ParkingMutex
+     *
+     * @brief A one byte mutex that spins briefly, then parks the waiting thread.
+     *
+     * Waiting is done through std::atomic::wait/notify (a futex, or the parking lot of the standard library
+     * for sizes the platform can't wait on directly), so the mutex itself only holds its state:
+     * unlocked, locked, or locked with (possibly) parked waiters. Only the last state makes unlock() wake a
+     * thread, the uncontended lock()/unlock() are a single atomic operation each.
+     */
+    class ParkingMutex
+    {
+    public:
+        ParkingMutex() = default;
+
+        ParkingMutex(const ParkingMutex&)            = delete;
+        ParkingMutex& operator=(const ParkingMutex&) = delete;
+
+        void lock() noexcept
+        {
+            auto expected = unlocked;
+            if (not m_state.compare_exchange_strong(expected, locked, std::memory_order_acquire)) {
+                lock_slow();
+            }
+        }
+
+        bool try_lock() noexcept
+        {
+            auto expected = unlocked;
+            return m_state.compare_exchange_strong(expected, locked, std::memory_order_acquire);
+        }
+
+        void unlock() noexcept
+        {
+            if (m_state.exchange(unlocked, std::memory_order_release) == parked) {
+                m_state.notify_one();
+            }
+        }
+
+    private:
+        static constexpr std::uint8_t unlocked   = 0;
+        static constexpr std::uint8_t locked     = 1;
+        static constexpr std::uint8_t parked     = 2;
+        static constexpr int          spin_limit = 64;
+
+        void lock_slow() noexcept
+        {
+            for (auto spin = 0; spin < spin_limit; ++spin) {
+                auto state = m_state.load(std::memory_order_relaxed);
+                if (state == parked) {
+                    break;    // others are already parked, don't jump the queue for long
+                }
+                if (state == unlocked
+                    and m_state.compare_exchange_weak(state, locked, std::memory_order_acquire)) {
+                    return;
+                }
+                detail::cpu_relax();
+            }
+
+            // we can't know whether other threads are still parked once we get the lock, so keep the
+            // 'parked' state to make sure our unlock wakes the next one up
+            while (m_state.exchange(parked, std::memory_order_acquire) != unlocked) {
+                m_state.wait(parked, std::memory_order_relaxed);
+            }
+        }
+
+        std::atomic<std::uint8_t> m_state = unlocked;
+    };
+
+    /**
+     * @class ParkingSharedMutex
+     *
+     * @brief A four byte shared mutex that spins briefly, then parks the waiting thread.
+     *
+     * The whole state (writer bit, pending writer bit, parked bit and reader count) lives in a single
+     * 32-bit word that is also the futex the waiters park on. A pending writer blocks new readers, so
+     * writers are not starved by a continuous stream of readers.
+     */
+    class ParkingSharedMutex
+    {
+    public:
+        ParkingSharedMutex() = default;
+
+        ParkingSharedMutex(const ParkingSharedMutex&)            = delete;
+        ParkingSharedMutex& operator=(const ParkingSharedMutex&) = delete;
+
+        void lock() noexcept
+        {
+            auto spin = 0;
+            while (true) {
+                auto state = m_state.load(std::memory_order_relaxed);
+                if ((state & (writer | readers)) == 0) {
+                    auto desired = (state | writer) & ~writer_pending;
+                    if (m_state.compare_exchange_weak(state, desired, std::memory_order_acquire)) {
+                        return;
+                    }
+                    continue;
+                }
+
+                if (spin++ < spin_limit) {
+                    detail::cpu_relax();
+                    continue;
+                }
+
+                park(state, state | writer_pending | parked);
+            }
+        }
+
+        bool try_lock() noexcept
+        {
+            auto state = m_state.load(std::memory_order_relaxed);
+            return (state & (writer | readers)) == 0
+               and m_state.compare_exchange_strong(
+                       state, (state | writer) & ~writer_pending, std::memory_order_acquire
+               );
+        }
+
+        void unlock() noexcept
+        {
+            if (m_state.fetch_and(~(writer | parked), std::memory_order_release) & parked) {
+                m_state.notify_all();
+            }
+        }
+
+        void lock_shared() noexcept
+        {
+            auto spin = 0;
+            while (true) {
+                auto state = m_state.load(std::memory_order_relaxed);
+                if (can_share(state)) {
+                    if (m_state.compare_exchange_weak(state, state + 1, std::memory_order_acquire)) {
+                        return;
+                    }
+                    continue;
+                }
+
+                if (spin++ < spin_limit) {
+                    detail::cpu_relax();
+                    continue;
+                }
+
+                park(state, state | parked);
+            }
+        }
+
+        bool try_lock_shared() noexcept
+        {
+            auto state = m_state.load(std::memory_order_relaxed);
+            return can_share(state)
+               and m_state.compare_exchange_strong(state, state + 1, std::memory_order_acquire);
+        }
+
+        void unlock_shared() noexcept
+        {
+            auto state = m_state.fetch_sub(1, std::memory_order_release);
+            if ((state & readers) == 1 and (state & parked)) {
+                if (m_state.fetch_and(~parked, std::memory_order_relaxed) & parked) {
+                    m_state.notify_all();
+                }
+            }
+        }
+
+    private:
+        static constexpr std::uint32_t writer         = 1u << 31;
+        static constexpr std::uint32_t writer_pending = 1u << 30;
+        static constexpr std::uint32_t parked         = 1u << 29;
+        static constexpr std::uint32_t readers        = parked - 1;
+        static constexpr int           spin_limit     = 64;
+
+        static bool can_share(std::uint32_t state) noexcept
+        {
+            return (state & (writer | writer_pending)) == 0 and (state & readers) != readers;
+        }
+
+        // announce ourselves as parked, then sleep until the state changes
+        void park(std::uint32_t state, std::uint32_t desired) noexcept
+        {
+            if (state == desired
+                or m_state.compare_exchange_weak(state, desired, std::memory_order_relaxed)) {
+                m_state.wait(desired, std::memory_order_relaxed);
+            }
+        }
+
+        std::atomic<std::uint32_t> m_state = 0;
+    };
+
+    /**
+     * @class ParkingUpgradeMutex
+     *
+     * @brief A four byte upgradeable shared mutex that spins briefly, then parks the waiting thread.
+     *
+     * Like ParkingSharedMutex, with an upgrade lock in between: one thread at a time may hold it alongside
+     * the readers, then turn it into the exclusive lock without letting any other writer in (waiting for the
+     * readers to leave, while new readers are held back). The exclusive lock can also turn into a shared
+     * lock without letting a writer in.
+     */
+    class ParkingUpgradeMutex
+    {
+    public:
+        ParkingUpgradeMutex() = default;
+
+        ParkingUpgradeMutex(const ParkingUpgradeMutex&)            = delete;
+        ParkingUpgradeMutex& operator=(const ParkingUpgradeMutex&) = delete;
+
+        void lock() noexcept
+        {
+            acquire(
+                [](std::uint32_t state) { return (state & (writer | upgrader | readers)) == 0; },
+                [](std::uint32_t state) { return (state | writer) & ~writer_pending; },
+                writer_pending
+            );
+        }
+
+        bool try_lock() noexcept
+        {
+            auto state = m_state.load(std::memory_order_relaxed);
+            return (state & (writer | upgrader | readers)) == 0
+               and m_state.compare_exchange_strong(
+                       state, (state | writer) & ~writer_pending, std::memory_order_acquire
+               );
+        }
+
+        void unlock() noexcept { release(writer); }
+
+        void lock_shared() noexcept
+        {
+            acquire(can_share, [](std::uint32_t state) { return state + 1; }, 0);
+        }
+
+        bool try_lock_shared() noexcept
+        {
+            auto state = m_state.load(std::memory_order_relaxed);
+            return can_share(state)
+               and m_state.compare_exchange_strong(state, state + 1, std::memory_order_acquire);
+        }
+
+        void unlock_shared() noexcept
+        {
+            auto state = m_state.fetch_sub(1, std::memory_order_release);
+            if ((state & readers) == 1 and (state & parked)) {
+                if (m_state.fetch_and(~parked, std::memory_order_relaxed) & parked) {
+                    m_state.notify_all();
+                }
+            }
+        }
+
+        void lock_upgrade() noexcept
+        {
+            acquire(can_upgrade, [](std::uint32_t state) { return state | upgrader; }, 0);
+        }
+
+        bool try_lock_upgrade() noexcept
+        {
+            auto state = m_state.load(std::memory_order_relaxed);
+            return can_upgrade(state)
+               and m_state.compare_exchange_strong(state, state | upgrader, std::memory_order_acquire);
+        }
+
+        void unlock_upgrade() noexcept { release(upgrader); }
+
+        // wait for the readers to leave, holding back new ones: no writer can get in while the upgrade bit is
+        // held, so the pending writer is announced before spinning
+        void unlock_upgrade_and_lock() noexcept
+        {
+            m_state.fetch_or(writer_pending, std::memory_order_relaxed);
+            acquire(
+                [](std::uint32_t state) { return (state & readers) == 0; },
+                [](std::uint32_t state) { return (state & ~(upgrader | writer_pending)) | writer; },
+                writer_pending
+            );
+        }
+
+        void unlock_upgrade_and_lock_shared() noexcept { transition(upgrader); }
+
+        void unlock_and_lock_shared() noexcept { transition(writer); }
+
+    private:
+        static constexpr std::uint32_t writer         = 1u << 31;
+        static constexpr std::uint32_t writer_pending = 1u << 30;
+        static constexpr std::uint32_t parked         = 1u << 29;
+        static constexpr std::uint32_t upgrader       = 1u << 28;
+        static constexpr std::uint32_t readers        = upgrader - 1;
+        static constexpr int           spin_limit     = 64;
+
+        static bool can_share(std::uint32_t state) noexcept
+        {
+            return (state & (writer | writer_pending)) == 0 and (state & readers) != readers;
+        }
+
+        static bool can_upgrade(std::uint32_t state) noexcept
+        {
+            return (state & (writer | writer_pending | upgrader)) == 0;
+        }
+
+        // spin, then park (announcing the given pending bits) until the state allows the transition
+        void acquire(auto&& can_acquire, auto&& acquired, std::uint32_t pending) noexcept
+        {
+            auto spin = 0;
+            while (true) {
+                auto state = m_state.load(std::memory_order_relaxed);
+                if (can_acquire(state)) {
+                    if (m_state.compare_exchange_weak(state, acquired(state), std::memory_order_acquire)) {
+                        return;
+                    }
+                    continue;
+                }
+
+                if (spin++ < spin_limit) {
+                    detail::cpu_relax();
+                    continue;
+                }
+
+                auto desired = state | pending | parked;
+                if (state == desired
+                    or m_state.compare_exchange_weak(state, desired, std::memory_order_relaxed)) {
+                    m_state.wait(desired, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        void release(std::uint32_t held) noexcept
+        {
+            if (m_state.fetch_and(~(held | parked), std::memory_order_release) & parked) {
+                m_state.notify_all();
+            }
+        }
+
+        // trade the held bit for a shared lock, wake the waiting readers
+        void transition(std::uint32_t held) noexcept
+        {
+            auto state = m_state.load(std::memory_order_relaxed);
+            while (not m_state.compare_exchange_weak(
+                state, (state & ~(held | parked)) + 1, std::memory_order_acq_rel
+            )) {
+            }
+            if (state & parked) {
+                m_state.notify_all();
+            }
+        }
+
+        std::atomic<std::uint32_t> m_state = 0;
+    };
+}
+
+#endif /* end of include guard: SYNC_CPP_MUTEX_PARKING_MUTEX_HPP_K0FD3QX7 */
@@ -0,0 +1,54 @@
+#ifndef SYNC_CPP_MUTEX_SPIN_LOCK_HPP_RW4E1D8S
+#define SYNC_CPP_MUTEX_SPIN_LOCK_HPP_RW4E1D8S
+
+#include "sync_cpp/concepts.hpp"
+#include "sync_cpp/mutex/backoff.hpp"
+
+#include <atomic>
+
+namespace spp
+{
+    /**
+     * @class SpinLock
+     *
+     * @brief A test-and-test-and-set spinlock.
+     *
+     * Waiters spin on a plain load (which stays in their cache) and only attempt the atomic exchange once the
+     * lock looks free. Use it for critical sections that are only a few nanoseconds long, where parking the
+     * thread in the kernel would cost more than the critical section itself.
+     *
+     * @tparam B The backoff policy used between failed attempts.
+     */
+    template <concepts::Backoff B = backoff::Exponential<>>
+    class SpinLock
+    {
+    public:
+        SpinLock() = default;
+
+        SpinLock(const SpinLock&)            = delete;
+        SpinLock& operator=(const SpinLock&) = delete;
+
+        void lock() noexcept
+        {
+            while (m_locked.exchange(true, std::memory_order_acquire)) {
+                auto backoff = B{};
+                while (m_locked.load(std::memory_order_relaxed)) {
+                    backoff();
+                }
+            }
+        }
+
+        bool try_lock() noexcept
+        {
+            return not m_locked.load(std::memory_order_relaxed)
+               and not m_locked.exchange(true, std::memory_order_acquire);
+        }
+
+        void unlock() noexcept { m_locked.store(false, std::memory_order_release); }
+
+    private:
+        std::atomic<bool> m_locked = false;
+    };
+}
+
+#endif /* end of include guard: SYNC_CPP_MUTEX_SPIN_LOCK_HPP_RW4E1D8S */
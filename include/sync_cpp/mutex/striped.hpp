@@ -0,0 +1,74 @@
+#ifndef SYNC_CPP_MUTEX_STRIPED_HPP_W6BN1RZE
+#define SYNC_CPP_MUTEX_STRIPED_HPP_W6BN1RZE
+
+#include "sync_cpp/concepts.hpp"
+#include "sync_cpp/detail/hardware.hpp"
+
+#include <array>
+#include <mutex>
+
+namespace spp
+{
+    /**
+     * @class Striped
+     *
+     * @brief A process-wide table of mutexes, objects are mapped to a stripe by their address.
+     *
+     * Used as the mutex type of Sync (and its derivatives), the Sync object holds no mutex at all: it locks
+     * the stripe its address hashes to (like libatomic does for atomics that are not lock-free). Unrelated
+     * objects may share a stripe, so this is meant for huge populations of rarely contended objects.
+     *
+     * Every instantiation (mutex type, stripe count) has its own table. Each stripe sits on its own cache
+     * line(s).
+     *
+     * WARNING: code holding the lock of a striped Sync must not access another Sync of the same table (in the
+     * function given to it, or in a callee). The other object may map to the same stripe, which a
+     * non-recursive mutex like std::mutex then tries to lock twice: a self-deadlock. On different stripes,
+     * two threads doing it in opposite orders deadlock each other, a lock-order inversion that appears
+     * nowhere in the code since it depends on the addresses. Access several of them through spp::group,
+     * which locks each stripe once and in a global order.
+     *
+     * @tparam M The mutex type of each stripe.
+     * @tparam Stripes The number of stripes (a power of two).
+     */
+    template <concepts::Lockable M = std::mutex, std::size_t Stripes = 256>
+        requires (Stripes > 0 and (Stripes & (Stripes - 1)) == 0)
+    class Striped
+    {
+    public:
+        using Mutex = M;
+
+        Striped() = delete;
+
+        /**
+         * @brief Get the index of the stripe an address maps to.
+         */
+        [[nodiscard]] static std::size_t stripe_index(const void* address) noexcept
+        {
+            return detail::address_hash(address, Stripes);
+        }
+
+        /**
+         * @brief Get the mutex of the stripe an address maps to.
+         */
+        [[nodiscard]] static M& stripe_for(const void* address) noexcept
+        {
+            return s_stripes[stripe_index(address)].m_mutex;
+        }
+
+        /**
+         * @brief Get the number of stripes.
+         */
+        static constexpr std::size_t stripe_count() { return Stripes; }
+
+    private:
+        struct alignas(detail::cache_line_size) Stripe
+        {
+            M m_mutex;
+        };
+
+        static inline std::array<Stripe, Stripes> s_stripes = {};
+    };
+}
+
+#endif /* end of include guard: SYNC_CPP_MUTEX_STRIPED_HPP_W6BN1RZE */
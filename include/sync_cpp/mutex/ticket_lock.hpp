@@ -0,0 +1,58 @@
+#ifndef SYNC_CPP_MUTEX_TICKET_LOCK_HPP_6XKD0P2M
+#define SYNC_CPP_MUTEX_TICKET_LOCK_HPP_6XKD0P2M
+
+#include "sync_cpp/concepts.hpp"
+#include "sync_cpp/mutex/backoff.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace spp
+{
+    /**
+     * @class TicketLock
+     *
+     * @brief A FIFO spinlock: every waiter takes a ticket and waits for its number to be served.
+     *
+     * Unlike SpinLock, the lock is handed over in arrival order so no waiter starves. All the waiters still
+     * spin on the same counter, prefer McsLock when many threads contend.
+     *
+     * @tparam B The backoff policy used between failed attempts.
+     */
+    template <concepts::Backoff B = backoff::Pause>
+    class TicketLock
+    {
+    public:
+        TicketLock() = default;
+
+        TicketLock(const TicketLock&)            = delete;
+        TicketLock& operator=(const TicketLock&) = delete;
+
+        void lock() noexcept
+        {
+            auto ticket  = m_next.fetch_add(1, std::memory_order_relaxed);
+            auto backoff = B{};
+            while (m_serving.load(std::memory_order_acquire) != ticket) {
+                backoff();
+            }
+        }
+
+        bool try_lock() noexcept
+        {
+            auto serving = m_serving.load(std::memory_order_relaxed);
+            auto ticket  = serving;
+            return m_next.compare_exchange_strong(ticket, serving + 1, std::memory_order_acquire);
+        }
+
+        void unlock() noexcept
+        {
+            m_serving.store(m_serving.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        }
+
+    private:
+        std::atomic<std::uint32_t> m_next    = 0;
+        std::atomic<std::uint32_t> m_serving = 0;
+    };
+}
+
+#endif /* end of include guard: SYNC_CPP_MUTEX_TICKET_LOCK_HPP_6XKD0P2M */
@@ -0,0 +1,383 @@
+#ifndef SYNC_CPP_REGISTRY_HPP_M7TB2XKA
+#define SYNC_CPP_REGISTRY_HPP_M7TB2XKA
+
+#include "sync_cpp/concepts.hpp"
+#include "sync_cpp/stats.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if __has_include(<unistd.h>)
+#    include <cerrno>
+#    include <unistd.h>
+#endif
+
+namespace spp
+{
+    class Registry;
+
+    /**
+     * @class Registration
+     *
+     * @brief The enrollment of an object in a Registry, withdrawn on destruction.
+     *
+     * Destroy it before the enrolled object (declare it after the object).
+     */
+    class [[nodiscard]] Registration
+    {
+    public:
+        Registration() = default;
+
+        Registration(Registration&& other) noexcept
+            : m_registry{ std::exchange(other.m_registry, nullptr) }
+            , m_id{ other.m_id }
+        {
+        }
+
+        Registration& operator=(Registration&& other) noexcept
+        {
+            if (this != &other) {
+                reset();
+                m_registry = std::exchange(other.m_registry, nullptr);
+                m_id       = other.m_id;
+            }
+            return *this;
+        }
+
+        ~Registration() { reset(); }
+
+        /**
+         * @brief Withdraw the enrollment now.
+         */
+        void reset() noexcept;
+
+    private:
+        friend class Registry;
+
+        Registration(Registry* registry, std::uint64_t id)
+            : m_registry{ registry }
+            , m_id{ id }
+        {
+        }
+
+        Registry*     m_registry = nullptr;
+        std::uint64_t m_id       = 0;
+    };
+
+    /**
+     * @class Registry
+     *
+     * @brief A central view of named Sync objects, reporting their lock statistics.
+     *
+     * Only objects whose mutex is instrumented (see spp::InstrumentedMutex) can enroll. Objects enrolled
+     * under the same name are reported together. Enrolling and withdrawing take a lock, accessing the
+     * objects does not involve the registry at all.
+     */
+    class Registry
+    {
+    public:
+        static constexpr std::size_t all = std::numeric_limits<std::size_t>::max();
+
+        /**
+         * @class Entry
+         *
+         * @brief The statistics of the objects enrolled under one name.
+         */
+        struct Entry
+        {
+            std::string m_name;
+            std::size_t m_objects = 0;
+            MutexStats  m_stats;
+
+            [[nodiscard]] std::uint64_t contended() const noexcept
+            {
+                return m_stats.m_exclusive.m_contended + m_stats.m_shared.m_contended;
+            }
+        };
+
+        /**
+         * @brief Get the process-wide registry.
+         */
+        static Registry& global()
+        {
+            static auto s_registry = Registry{};
+            return s_registry;
+        }
+
+        Registry() = default;
+
+        Registry(const Registry&)            = delete;
+        Registry& operator=(const Registry&) = delete;
+
+        /**
+         * @brief Enroll a Sync object (or derivative, e.g. SyncOpt, SyncUnique) under a name.
+         *
+         * @param name The name the object is reported under.
+         * @param sync The object, it must outlive the returned Registration.
+         *
+         * @return The enrollment, the object is withdrawn when it is destroyed.
+         */
+        template <concepts::SyncDerivative S>
+            requires concepts::InstrumentedLockable<typename S::Mutex>
+        Registration enroll(std::string name, const S& sync)
+        {
+            auto stats = [](const void* object) -> MutexStats {
+                return static_cast<const S*>(object)->mutex().stats();
+            };
+
+            auto lock = std::lock_guard{ m_mutex };
+            m_objects.push_back({ ++m_last_id, std::move(name), &sync, stats });
+            return { this, m_last_id };
+        }
+
+        /**
+         * @brief Collect the statistics of every name, hottest (most contended acquisitions) first.
+         *
+         * @param top The maximum number of names to collect.
+         */
+        [[nodiscard]] std::vector<Entry> collect(std::size_t top = all) const
+        {
+            auto entries = std::vector<Entry>{};
+            {
+                auto lock = std::lock_guard{ m_mutex };
+                for (const auto& object : m_objects) {
+                    auto stats = object.m_stats(object.m_object);
+                    auto entry = std::ranges::find(entries, object.m_name, &Entry::m_name);
+                    if (entry == entries.end()) {
+                        entries.push_back({ object.m_name, 1, stats });
+                    } else {
+                        entry->m_objects += 1;
+                        entry->m_stats.m_exclusive.merge(stats.m_exclusive);
+                        entry->m_stats.m_shared.merge(stats.m_shared);
+                    }
+                }
+            }
+
+            std::ranges::stable_sort(entries, std::greater{}, &Entry::contended);
+            entries.resize(std::min(top, entries.size()));
+            return entries;
+        }
+
+        /**
+         * @brief Write a report in the Prometheus text exposition format.
+         *
+         * Per name and lock mode: the acquisition and contended acquisition counters, the contention ratio,
+         * the wait and hold time summaries (median, 90th and 99th percentile) and the longest hold.
+         *
+         * @param out The stream to write to.
+         * @param top The maximum number of names to report, hottest first.
+         */
+        void write_prometheus(std::ostream& out, std::size_t top = all) const
+        {
+            auto entries   = collect(top);
+            auto precision = out.precision(9);
+
+            auto header = [&](std::string_view metric, std::string_view type, std::string_view help) {
+                out << "# HELP sync_cpp_lock_" << metric << ' ' << help << '\n';
+                out << "# TYPE sync_cpp_lock_" << metric << ' ' << type << '\n';
+            };
+            auto sample = [&](std::string_view metric, std::string_view labels, auto value) {
+                out << "sync_cpp_lock_" << metric << '{' << labels << "} " << value << '\n';
+            };
+            auto for_each_mode = [&](auto&& fn) {
+                for (const auto& entry : entries) {
+                    fn(entry.m_stats.m_exclusive, labels(entry.m_name, "exclusive"));
+                    fn(entry.m_stats.m_shared, labels(entry.m_name, "shared"));
+                }
+            };
+            auto summary = [&](std::string_view metric, Histogram LockStats::* histogram) {
+                for_each_mode([&](const LockStats& stats, const std::string& labels) {
+                    const auto& values = stats.*histogram;
+                    for (auto [quantile, label] : quantiles) {
+                        auto quantile_labels = labels + ",quantile=\"" + std::string{ label } + '"';
+                        sample(metric, quantile_labels, seconds(values.percentile(quantile)));
+                    }
+                    sample(std::string{ metric } + "_sum", labels, seconds(values.sum()));
+                    sample(std::string{ metric } + "_count", labels, values.count());
+                });
+            };
+
+            header("acquisitions_total", "counter", "Lock acquisitions.");
+            for_each_mode([&](const LockStats& stats, const std::string& labels) {
+                sample("acquisitions_total", labels, stats.m_acquisitions);
+            });
+
+            header("contended_total", "counter", "Lock acquisitions that had to wait.");
+            for_each_mode([&](const LockStats& stats, const std::string& labels) {
+                sample("contended_total", labels, stats.m_contended);
+            });
+
+            header("contention_ratio", "gauge", "Fraction of the lock acquisitions that had to wait.");
+            for_each_mode([&](const LockStats& stats, const std::string& labels) {
+                sample("contention_ratio", labels, stats.contention_rate());
+            });
+
+            header("wait_seconds", "summary", "Time spent waiting for the lock.");
+            summary("wait_seconds", &LockStats::m_wait);
+
+            header("hold_seconds", "summary", "Time the lock was held.");
+            summary("hold_seconds", &LockStats::m_hold);
+
+            header("hold_max_seconds", "gauge", "Longest time the lock was held.");
+            for_each_mode([&](const LockStats& stats, const std::string& labels) {
+                sample("hold_max_seconds", labels, seconds(stats.m_hold.max()));
+            });
+
+            out.precision(precision);
+        }
+
+        /**
+         * @brief Get a report in the Prometheus text exposition format, see write_prometheus.
+         */
+        [[nodiscard]] std::string prometheus(std::size_t top = all) const
+        {
+            auto out = std::ostringstream{};
+            write_prometheus(out, top);
+            return std::move(out).str();
+        }
+
+#if __has_include(<unistd.h>)
+        /**
+         * @brief Write a report in the Prometheus text exposition format to a file descriptor.
+         *
+         * @return False if writing failed (errno is set).
+         */
+        bool write_prometheus(int fd, std::size_t top = all) const
+        {
+            auto report = prometheus(top);
+            auto data   = std::string_view{ report };
+            while (not data.empty()) {
+                auto written = ::write(fd, data.data(), data.size());
+                if (written < 0 and errno != EINTR) {
+                    return false;
+                }
+                data.remove_prefix(written < 0 ? 0 : static_cast<std::size_t>(written));
+            }
+            return true;
+        }
+#endif
+
+    private:
+        friend class Registration;
+
+        struct Object
+        {
+            std::uint64_t m_id;
+            std::string   m_name;
+            const void*   m_object;
+            MutexStats (*m_stats)(const void*);
+        };
+
+        static constexpr std::pair<double, std::string_view> quantiles[] = {
+            { 0.5, "0.5" },
+            { 0.9, "0.9" },
+            { 0.99, "0.99" },
+        };
+
+        static std::string labels(std::string_view name, std::string_view mode)
+        {
+            auto labels = std::string{ "name=\"" };
+            for (auto c : name) {
+                switch (c) {
+                case '\\': labels += "\\\\"; break;
+                case '"': labels += "\\\""; break;
+                case '\n': labels += "\\n"; break;
+                default: labels += c;
+                }
+            }
+            return labels.append("\",mode=\"").append(mode).append("\"");
+        }
+
+        static double seconds(std::uint64_t nanoseconds) noexcept
+        {
+            return static_cast<double>(nanoseconds) / 1e9;
+        }
+
+        void withdraw(std::uint64_t id) noexcept
+        {
+            auto lock = std::lock_guard{ m_mutex };
+            std::erase_if(m_objects, [&](const Object& object) { return object.m_id == id; });
+        }
+
+        mutable std::mutex  m_mutex;
+        std::vector<Object> m_objects;
+        std::uint64_t       m_last_id = 0;
+    };
+
+    inline void Registration::reset() noexcept
+    {
+        if (auto registry = std::exchange(m_registry, nullptr)) {
+            registry->withdraw(m_id);
+        }
+    }
+
+    /**
+     * @class ReportTrigger
+     *
+     * @brief Run a report on a background thread whenever requested, e.g. from a signal handler.
+     *
+     * request() only sets a lock-free atomic flag, so it is async-signal-safe; the background thread polls
+     * the flag and runs the report outside of the signal context.
+     */
+    class ReportTrigger
+    {
+    public:
+        static_assert(std::atomic<bool>::is_always_lock_free);
+
+        /**
+         * @param report The report to run on every request, e.g. writing Registry::global() to a descriptor.
+         * @param poll_interval How often the flag is checked.
+         */
+        explicit ReportTrigger(
+            std::function<void()>     report,
+            std::chrono::milliseconds poll_interval = std::chrono::milliseconds{ 100 }
+        )
+            : m_report{ std::move(report) }
+            , m_thread{ [this, poll_interval](std::stop_token token) { run(token, poll_interval); } }
+        {
+        }
+
+        ReportTrigger(const ReportTrigger&)            = delete;
+        ReportTrigger& operator=(const ReportTrigger&) = delete;
+
+        /**
+         * @brief Request a report, async-signal-safe.
+         */
+        void request() noexcept { m_requested.store(true, std::memory_order_relaxed); }
+
+    private:
+        void run(std::stop_token token, std::chrono::milliseconds poll_interval)
+        {
+            auto mutex = std::mutex{};
+            auto wake  = std::condition_variable_any{};
+            auto lock  = std::unique_lock{ mutex };
+            while (not token.stop_requested()) {
+                if (m_requested.exchange(false, std::memory_order_relaxed)) {
+                    m_report();
+                }
+                wake.wait_for(lock, token, poll_interval, [] { return false; });
+            }
+        }
+
+        std::atomic<bool>     m_requested = false;
+        std::function<void()> m_report;
+        std::jthread          m_thread;
+    };
+}
+
+#endif /* end of include guard: SYNC_CPP_REGISTRY_HPP_M7TB2XKA */
@@ -0,0 +1,228 @@
+#ifndef SYNC_CPP_STATS_HPP_R5HV2NDQ
+#define SYNC_CPP_STATS_HPP_R5HV2NDQ
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace spp
+{
+    namespace detail
+    {
+        class AtomicHistogram;
+    }
+
+    /**
+     * @class Histogram
+     *
+     * @brief A log-linear histogram of durations in nanoseconds (HDR-style).
+     *
+     * Every power of two is split into a fixed number of linear sub-buckets, so the relative error of a
+     * recorded value is bounded (1 / sub_buckets, 12.5%) over the whole range. Values at or above
+     * 2^max_exponent are counted in the last bucket. It takes about 2.4 KB.
+     */
+    class Histogram
+    {
+    public:
+        static constexpr std::size_t sub_bucket_bits = 3;
+        static constexpr std::size_t sub_buckets     = std::size_t{ 1 } << sub_bucket_bits;
+        static constexpr std::size_t max_exponent    = 40;    // ~18 minutes in nanoseconds
+        static constexpr std::size_t bucket_count    = (max_exponent - sub_bucket_bits + 1) * sub_buckets;
+
+        using Buckets = std::array<std::uint64_t, bucket_count>;
+
+        /**
+         * @brief Get the index of the bucket a value falls in.
+         */
+        static constexpr std::size_t bucket_of(std::uint64_t value) noexcept
+        {
+            if (value < sub_buckets) {
+                return static_cast<std::size_t>(value);
+            }
+            auto exponent = static_cast<std::size_t>(std::bit_width(value)) - 1;
+            if (exponent >= max_exponent) {
+                return bucket_count - 1;
+            }
+            auto sub = (value >> (exponent - sub_bucket_bits)) & (sub_buckets - 1);
+            return (exponent - sub_bucket_bits + 1) * sub_buckets + static_cast<std::size_t>(sub);
+        }
+
+        /**
+         * @brief Get the smallest value that falls in a bucket.
+         */
+        static constexpr std::uint64_t lower_bound(std::size_t bucket) noexcept
+        {
+            if (bucket < sub_buckets) {
+                return bucket;
+            }
+            auto exponent = bucket / sub_buckets + sub_bucket_bits - 1;
+            auto sub      = bucket % sub_buckets;
+            return (std::uint64_t{ sub_buckets } + sub) << (exponent - sub_bucket_bits);
+        }
+
+        /**
+         * @brief Get the largest value that falls in a bucket (the last bucket is open-ended).
+         */
+        static constexpr std::uint64_t upper_bound(std::size_t bucket) noexcept
+        {
+            return lower_bound(bucket + 1) - 1;
+        }
+
+        /**
+         * @brief Record a value.
+         */
+        void record(std::uint64_t value, std::uint64_t count = 1) noexcept
+        {
+            m_buckets[bucket_of(value)] += count;
+            m_count += count;
+            m_sum   += value * count;
+            m_max    = std::max(m_max, value);
+        }
+
+        /**
+         * @brief Add the values recorded in another histogram.
+         */
+        void merge(const Histogram& other) noexcept
+        {
+            for (auto i = 0u; i < bucket_count; ++i) {
+                m_buckets[i] += other.m_buckets[i];
+            }
+            m_count += other.m_count;
+            m_sum   += other.m_sum;
+            m_max    = std::max(m_max, other.m_max);
+        }
+
+        /**
+         * @brief Get the value below which a fraction of the recorded values fall (bucket upper bound).
+         *
+         * @param quantile The fraction, in [0, 1].
+         */
+        [[nodiscard]] std::uint64_t percentile(double quantile) const noexcept
+        {
+            if (m_count == 0) {
+                return 0;
+            }
+
+            auto rank = static_cast<std::uint64_t>(quantile * static_cast<double>(m_count - 1)) + 1;
+            auto seen = std::uint64_t{ 0 };
+            for (auto i = 0u; i < bucket_count; ++i) {
+                seen += m_buckets[i];
+                if (seen >= rank) {
+                    return std::min(upper_bound(i), m_max);
+                }
+            }
+            return m_max;
+        }
+
+        [[nodiscard]] double mean() const noexcept
+        {
+            return m_count == 0 ? 0.0 : static_cast<double>(m_sum) / static_cast<double>(m_count);
+        }
+
+        [[nodiscard]] std::uint64_t  count() const noexcept { return m_count; }
+        [[nodiscard]] std::uint64_t  sum() const noexcept { return m_sum; }
+        [[nodiscard]] std::uint64_t  max() const noexcept { return m_max; }
+        [[nodiscard]] const Buckets& buckets() const noexcept { return m_buckets; }
+
+    private:
+        friend class detail::AtomicHistogram;
+
+        Buckets       m_buckets = {};
+        std::uint64_t m_count   = 0;
+        std::uint64_t m_sum     = 0;
+        std::uint64_t m_max     = 0;
+    };
+
+    /**
+     * @class LockStats
+     *
+     * @brief Statistics of the acquisitions of a mutex in one mode (shared or exclusive).
+     *
+     * The wait histogram has a value for every acquisition (zero when uncontended), the hold histogram for
+     * every release. Durations are in nanoseconds.
+     */
+    struct LockStats
+    {
+        std::uint64_t m_acquisitions = 0;
+        std::uint64_t m_contended    = 0;
+        Histogram     m_wait;
+        Histogram     m_hold;
+
+        [[nodiscard]] double contention_rate() const noexcept
+        {
+            return m_acquisitions == 0
+                     ? 0.0
+                     : static_cast<double>(m_contended) / static_cast<double>(m_acquisitions);
+        }
+
+        void merge(const LockStats& other) noexcept
+        {
+            m_acquisitions += other.m_acquisitions;
+            m_contended    += other.m_contended;
+            m_wait.merge(other.m_wait);
+            m_hold.merge(other.m_hold);
+        }
+    };
+
+    /**
+     * @class MutexStats
+     *
+     * @brief A snapshot of the statistics of a mutex, shared and exclusive locks are reported separately.
+     */
+    struct MutexStats
+    {
+        LockStats m_exclusive;
+        LockStats m_shared;
+    };
+}
+
+namespace spp::detail
+{
+    /**
+     * @class AtomicHistogram
+     *
+     * @brief The concurrently recorded counterpart of Histogram, every operation is a relaxed atomic.
+     */
+    class AtomicHistogram
+    {
+    public:
+        void record(std::uint64_t value) noexcept
+        {
+            m_buckets[Histogram::bucket_of(value)].fetch_add(1, std::memory_order_relaxed);
+            m_sum.fetch_add(value, std::memory_order_relaxed);
+
+            auto max = m_max.load(std::memory_order_relaxed);
+            while (value > max and not m_max.compare_exchange_weak(max, value, std::memory_order_relaxed)) { }
+        }
+
+        void add_to(Histogram& histogram) const noexcept
+        {
+            for (auto i = 0u; i < Histogram::bucket_count; ++i) {
+                auto count = m_buckets[i].load(std::memory_order_relaxed);
+                histogram.m_buckets[i] += count;
+                histogram.m_count      += count;
+            }
+            histogram.m_sum += m_sum.load(std::memory_order_relaxed);
+            histogram.m_max  = std::max(histogram.m_max, m_max.load(std::memory_order_relaxed));
+        }
+
+        void reset() noexcept
+        {
+            for (auto& bucket : m_buckets) {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+            m_sum.store(0, std::memory_order_relaxed);
+            m_max.store(0, std::memory_order_relaxed);
+        }
+
+    private:
+        std::array<std::atomic<std::uint64_t>, Histogram::bucket_count> m_buckets = {};
+        std::atomic<std::uint64_t>                                      m_sum     = 0;
+        std::atomic<std::uint64_t>                                      m_max     = 0;
+    };
+}
+
+#endif /* end of include guard: SYNC_CPP_STATS_HPP_R5HV2NDQ */
@@ -0,0 +1,267 @@
+#ifndef SYNC_CPP_SUBSCRIPTION_HPP_K7DW2PXN
+#define SYNC_CPP_SUBSCRIPTION_HPP_K7DW2PXN
+
+#include "sync_cpp/detail/hardware.hpp"
+#include "sync_cpp/detail/listeners.hpp"
+#include "sync_cpp/mutex/spin_lock.hpp"
+#include "sync_cpp/detail/task.hpp"
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace spp
+{
+    namespace detail
+    {
+        /**
+         * @class SubscriptionState
+         *
+         * @brief A subscription to the changes of one object, shared by its handle and the notifier.
+         */
+        struct SubscriptionState
+        {
+            SubscriptionState(const void* address, Task deliver)
+                : m_address{ address }
+                , m_deliver{ std::move(deliver) }
+            {
+            }
+
+            const void*       m_address;
+            Task              m_deliver;              // takes the snapshot and calls the callback
+            std::atomic<bool> m_pending   = false;    // queued, the writes until the delivery coalesce
+            std::atomic<bool> m_cancelled = false;
+            std::mutex        m_delivery;             // held while delivering, unsubscribing waits for it
+        };
+
+        /**
+         * @class Notifier
+         *
+         * @brief The process-wide notifier thread of the subscriptions (see Sync::subscribe).
+         *
+         * The subscriptions are kept in buckets by the address of their object. A write looks up the
+         * subscriptions of its object after unlocking (only if there is any subscription at all), marks them
+         * pending and queues those that weren't; the notifier thread clears the mark, then delivers. So any
+         * number of writes until the delivery make a single notification, and a writer never waits for a
+         * callback.
+         */
+        class Notifier
+        {
+        public:
+            static constexpr std::size_t buckets = 256;
+
+            Notifier(const Notifier&)            = delete;
+            Notifier& operator=(const Notifier&) = delete;
+
+            [[nodiscard]] static Notifier& instance()
+            {
+                static auto notifier = Notifier{};
+                return notifier;
+            }
+
+            /**
+             * @brief Queue the subscriptions of a written object; called after unlocking.
+             */
+            static void publish(const void* address)
+            {
+                if (s_subscriptions.load(std::memory_order_acquire) == 0) {
+                    return;
+                }
+                instance().queue_changed(address);
+            }
+
+            /**
+             * @brief Register a subscription, its first delivery is the current value.
+             */
+            void subscribe(const std::shared_ptr<SubscriptionState>& state)
+            {
+                {
+                    auto& bucket = bucket_for(state->m_address);
+                    auto  lock   = std::lock_guard{ bucket.m_lock };
+                    bucket.m_subscriptions.push_back(state);
+                }
+                s_subscriptions.fetch_add(1, std::memory_order_release);
+                Listeners::add();
+
+                if (state->m_pending.exchange(true)) {
+                    return;    // a write queued it already
+                }
+                {
+                    auto lock = std::lock_guard{ m_queue_mutex };
+                    m_queue.push_back(state);
+                }
+                m_queue_cv.notify_one();
+            }
+
+            /**
+             * @brief Remove a subscription, waiting for its delivery in progress unless called from it.
+             */
+            void unsubscribe(const std::shared_ptr<SubscriptionState>& state)
+            {
+                {
+                    auto& bucket = bucket_for(state->m_address);
+                    auto  lock   = std::lock_guard{ bucket.m_lock };
+                    std::erase(bucket.m_subscriptions, state);
+                }
+                s_subscriptions.fetch_sub(1, std::memory_order_relaxed);
+                Listeners::remove();
+
+                if (std::this_thread::get_id() == m_thread.get_id()) {
+                    state->m_cancelled.store(true, std::memory_order_relaxed);
+                } else {
+                    auto lock = std::lock_guard{ state->m_delivery };
+                    state->m_cancelled.store(true, std::memory_order_relaxed);
+                }
+            }
+
+        private:
+            struct alignas(cache_line_size) Bucket
+            {
+                SpinLock<>                                      m_lock;
+                std::vector<std::shared_ptr<SubscriptionState>> m_subscriptions;
+            };
+
+            Notifier()
+                : m_thread{ [this](std::stop_token token) { run(std::move(token)); } }
+            {
+                Listeners::set_publish(&Notifier::publish);
+            }
+
+            Bucket& bucket_for(const void* address)
+            {
+                return m_buckets[address_hash(address, buckets)];
+            }
+
+            // the states are marked under the spinlock, then queued under the queue mutex alone: a writer
+            // never blocks (nor spins behind one that blocks) while holding the spinlock
+            void queue_changed(const void* address)
+            {
+                auto changed = std::vector<std::shared_ptr<SubscriptionState>>{};
+                {
+                    auto& bucket = bucket_for(address);
+                    auto  lock   = std::lock_guard{ bucket.m_lock };
+                    for (const auto& state : bucket.m_subscriptions) {
+                        if (state->m_address == address and not state->m_pending.exchange(true)) {
+                            changed.push_back(state);
+                        }
+                    }
+                }
+                if (changed.empty()) {
+                    return;
+                }
+                {
+                    auto lock = std::lock_guard{ m_queue_mutex };
+                    m_queue.insert(m_queue.end(), changed.begin(), changed.end());
+                }
+                m_queue_cv.notify_one();
+            }
+
+            void run(std::stop_token token)
+            {
+                while (true) {
+                    auto state = std::shared_ptr<SubscriptionState>{};
+                    {
+                        auto lock = std::unique_lock{ m_queue_mutex };
+                        if (not m_queue_cv.wait(lock, token, [&] { return not m_queue.empty(); })) {
+                            return;
+                        }
+                        state = std::move(m_queue.front());
+                        m_queue.pop_front();
+                    }
+
+                    // cleared before the snapshot is taken, a write from now on queues it again
+                    state->m_pending.store(false, std::memory_order_seq_cst);
+
+                    auto lock = std::lock_guard{ state->m_delivery };
+                    if (not state->m_cancelled.load(std::memory_order_relaxed)) {
+                        state->m_deliver();
+                    }
+                }
+            }
+
+            static inline std::atomic<std::size_t> s_subscriptions = 0;
+
+            std::array<Bucket, buckets>                    m_buckets;
+            std::mutex                                     m_queue_mutex;
+            std::condition_variable_any                    m_queue_cv;
+            std::deque<std::shared_ptr<SubscriptionState>> m_queue;
+            std::jthread                                   m_thread;    // last: started once the rest exists
+        };
+    }
+
+    /**
+     * @class Subscription
+     *
+     * @brief The handle of a subscription to the changes of a Sync object (see Sync::subscribe), the callback
+     * is called until it's unsubscribed or destroyed.
+     *
+     * It must not outlive the object, and must not be destroyed while holding the lock of the object.
+     */
+    class [[nodiscard]] Subscription
+    {
+    public:
+        Subscription() = default;
+
+        explicit Subscription(std::shared_ptr<detail::SubscriptionState> state)
+            : m_state{ std::move(state) }
+        {
+        }
+
+        Subscription(Subscription&&) noexcept = default;
+
+        Subscription& operator=(Subscription&& other) noexcept
+        {
+            if (this != &other) {
+                unsubscribe();
+                m_state = std::move(other.m_state);
+            }
+            return *this;
+        }
+
+        ~Subscription() { unsubscribe(); }
+
+        /**
+         * @brief Stop the notifications, after the delivery in progress (if any) has returned.
+         *
+         * May be called from the callback itself.
+         */
+        void unsubscribe()
+        {
+            if (m_state != nullptr) {
+                detail::Notifier::instance().unsubscribe(m_state);
+                m_state.reset();
+            }
+        }
+
+        bool active() const noexcept { return m_state != nullptr; }
+
+    private:
+        std::shared_ptr<detail::SubscriptionState> m_state;
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief Subscribe to the changes of the object at an address (see Sync::subscribe).
+         *
+         * @param deliver Takes the snapshot and calls the callback.
+         */
+        template <typename Deliver>
+        Subscription subscribe(const void* address, Deliver&& deliver)
+        {
+            auto state = std::make_shared<SubscriptionState>(address, Task{ std::forward<Deliver>(deliver) });
+            Notifier::instance().subscribe(state);
+            return Subscription{ std::move(state) };
+        }
+    }
+}
+
+#endif /* end of include guard: SYNC_CPP_SUBSCRIPTION_HPP_K7DW2PXN */
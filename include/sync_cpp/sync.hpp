@@ -2,29 +2,101 @@
 #define SYNC_CPP_SYNC_CPP_49PEW7R6FEO7DS
 
 #include "sync_cpp/concepts.hpp"
-
+#include "sync_cpp/detail/acquire.hpp"
+#include "sync_cpp/detail/hardware.hpp"
+#include "sync_cpp/detail/optional_result.hpp"
+#include "sync_cpp/detail/trace.hpp"
+#include "sync_cpp/detail/upgrade_lock.hpp"
+#include "sync_cpp/detail/wait_table.hpp"
+#include "sync_cpp/lock_policy.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <concepts>
+#include <functional>
+#include <memory>
 #include <mutex>
+#include <optional>
 #include <shared_mutex>
+#include <stop_token>
 #include <utility>
 
 namespace spp
 {
+    class Subscription;
+
+    namespace detail
+    {
+        // defined in sync_cpp/subscription.hpp, to be included to call Sync::subscribe
+        template <typename Deliver>
+        Subscription subscribe(const void* address, Deliver&& deliver);
+    }
+}
+
+namespace spp::detail
+{
+    // the mutex type that is actually locked: the stripe type for a striped lock table
+    template <typename M>
+    struct SyncMutexType
+    {
+        using Type = M;
+    };
+
+    template <concepts::StripedMutex M>
+    struct SyncMutexType<M>
+    {
+        using Type = typename M::Mutex;
+    };
+
+    // stands in for the mutex member when the mutex lives in a striped lock table
+    struct NoMutex
+    {
+    };
+}
+
+namespace spp
+{
+    /**
+     * @brief The memory layout of the value and the mutex inside a Sync object.
+     */
+    enum class SyncLayout
+    {
+        Compact,     // value and mutex next to each other, smallest footprint (best when uncontended)
+        Isolated,    // value and mutex each on their own cache line(s)
+        Padded,      // value and mutex next to each other, the whole object occupies its own cache line(s)
+    };
+
     /**
      * @class Sync
      *
      * @brief A wrapper around a class object with a mutex.
      *
      * @tparam T The type of the object to wrap.
+     * @tparam M The mutex type, or a striped lock table (see spp::Striped) to hold no mutex at all.
+     * @tparam InternalMutex Whether the mutex is stored inside the object or provided (and owned) by the user.
+     * @tparam Layout The memory layout of the object, see SyncLayout.
      */
-    template <concepts::Syncable T, concepts::SyncMutex M = std::mutex, bool InternalMutex = true>
+    template <
+        concepts::Syncable  T,
+        concepts::SyncMutex M             = std::mutex,
+        bool                InternalMutex = true,
+        SyncLayout          Layout        = SyncLayout::Compact>
     class Sync : public tag::SyncTag
     {
     public:
-        template <typename... Ts>
-        friend class Group;
+        template <concepts::LockPolicy Policy, typename... Ts>
+        friend class BasicGroup;
+
+        template <concepts::SyncDerivative S, concepts::LockPolicy Policy>
+        friend class DynamicGroup;
 
         using Value = T;
-        using Mutex = M;
+        using Mutex = typename detail::SyncMutexType<M>::Type;
+
+        static_assert(
+            InternalMutex or not concepts::StripedMutex<M>,
+            "A striped lock table is owned by the library, it can't be provided by the user."
+        );
 
         Sync(const Sync&)            = delete;
         Sync& operator=(const Sync&) = delete;
@@ -57,12 +129,15 @@ namespace spp
          * @brief Get member object by copy.
          *
          * @tparam The type of the member object.
+         * @param site The call site recorded by tracing and the watchdog, when compiled in.
          * @return Copy of the member object.
          */
         template <typename TT>
-        [[nodiscard]] TT get(TT T::* mem) const
+        [[nodiscard]] TT get(TT T::* mem, detail::CallSite site = detail::CallSite::current()) const
         {
-            auto lock = lock_read();
+            auto trace = trace_read(site);
+            auto lock  = lock_read();
+            trace.acquired();
             return m_value.*mem;
         }
 
@@ -85,7 +160,9 @@ namespace spp
                 "copying instead."
             );
 
-            auto lock = lock_read();
+            auto trace = trace_read(detail::CallSite{});
+            auto lock  = lock_read();
+            trace.acquired();
             return (m_value.*fn)(std::forward<Args>(args)...);
         }
 
@@ -108,7 +185,10 @@ namespace spp
                 "copying instead."
             );
 
-            auto lock = lock_write();
+            auto notify = notify_write();
+            auto trace  = trace_write(detail::CallSite{});
+            auto lock   = lock_write();
+            trace.acquired();
             return (m_value.*fn)(std::forward<Args>(args)...);
         }
 
@@ -131,7 +211,9 @@ namespace spp
                 "copying instead."
             );
 
-            auto lock = lock_read();
+            auto trace = trace_read(detail::CallSite{});
+            auto lock  = lock_read();
+            trace.acquired();
             return (m_value.*fn)(std::forward<Args>(args)...);
         }
 
@@ -154,7 +236,10 @@ namespace spp
                 "copying instead."
             );
 
-            auto lock = lock_write();
+            auto notify = notify_write();
+            auto trace  = trace_write(detail::CallSite{});
+            auto lock   = lock_write();
+            trace.acquired();
             return (m_value.*fn)(std::forward<Args>(args)...);
         }
 
@@ -162,10 +247,14 @@ namespace spp
          * @brief Access the wrapped value in a read-only context.
          *
          * @param fn The function to call with the value.
+         * @param site The call site recorded by tracing and the watchdog, when compiled in.
          *
          * @return The return value of the function.
          */
-        [[nodiscard]] decltype(auto) read(std::invocable<const T&> auto&& fn) const
+        [[nodiscard]] decltype(auto) read(
+            std::invocable<const T&> auto&& fn,
+            detail::CallSite                site = detail::CallSite::current()
+        ) const
         {
             static_assert(
                 not std::is_lvalue_reference_v<decltype(fn(m_value))>,
@@ -173,7 +262,9 @@ namespace spp
                 "instead"
             );
 
-            auto lock = lock_read();
+            auto trace = trace_read(site);
+            auto lock  = lock_read();
+            trace.acquired();
             return std::forward<decltype(fn)>(fn)(m_value);
         }
 
@@ -181,10 +272,14 @@ namespace spp
          * @brief Access the wrapped value in a read-write context.
          *
          * @param fn The function to call with the value.
+         * @param site The call site recorded by tracing and the watchdog, when compiled in.
          *
          * @return The return value of the function.
          */
-        [[nodiscard]] decltype(auto) write(std::invocable<T&> auto&& fn)
+        [[nodiscard]] decltype(auto) write(
+            std::invocable<T&> auto&& fn,
+            detail::CallSite          site = detail::CallSite::current()
+        )
         {
             static_assert(
                 not std::is_lvalue_reference_v<decltype(fn(m_value))>,
@@ -192,10 +287,465 @@ namespace spp
                 "instead."
             );
 
-            auto lock = lock_write();
+            auto notify = notify_write();
+            auto trace  = trace_write(site);
+            auto lock   = lock_write();
+            trace.acquired();
             return std::forward<decltype(fn)>(fn)(m_value);
         }
 
+        /**
+         * @brief Modify the wrapped value only if a condition on it holds, without excluding the readers
+         * while checking it.
+         *
+         * With an upgradeable mutex (see concepts::UpgradeLockable) the condition is checked under the
+         * upgrade lock, then the lock is upgraded in place, so nothing can change in between; only the calls
+         * to update() exclude each other while checking. Other shared mutexes check it under a shared lock,
+         * then take the exclusive lock and check it again. Other mutexes check it under the exclusive lock.
+         *
+         * @param pred The condition on the value.
+         * @param fn The function to call with the value if the condition holds.
+         * @param site The call site recorded by tracing and the watchdog, when compiled in.
+         *
+         * @return The return value of the function (or true if it returns void), empty if the condition does
+         * not hold.
+         */
+        [[nodiscard]] auto update(
+            std::predicate<const T&> auto&& pred,
+            std::invocable<T&> auto&&       fn,
+            detail::CallSite                site = detail::CallSite::current()
+        )
+        {
+            using Result = detail::OptionalResult<std::invoke_result_t<decltype(fn), T&>>;
+
+            static_assert(
+                not std::is_lvalue_reference_v<std::invoke_result_t<decltype(fn), T&>>,
+                "Function returning a reference in multithreaded context is dangerous! Consider copying "
+                "instead."
+            );
+
+            auto holds  = [&] { return std::invoke(pred, std::as_const(m_value)); };
+            auto notify = notify_write();
+            auto trace  = trace_write(site);
+
+            if constexpr (concepts::UpgradeLockable<Mutex>) {
+                auto lock = detail::UpgradeLock{ mutex() };
+                trace.acquired();
+                if (not holds()) {
+                    notify.dismiss();
+                    return Result{};
+                }
+                lock.upgrade();
+                return detail::invoke_optional(std::forward<decltype(fn)>(fn), m_value);
+            } else {
+                if constexpr (concepts::SharedLockable<Mutex>) {
+                    auto lock = std::shared_lock{ mutex() };
+                    if (not holds()) {
+                        notify.dismiss();
+                        return Result{};
+                    }
+                }
+
+                auto lock = lock_write();
+                trace.acquired();
+                if (not holds()) {
+                    notify.dismiss();
+                    return Result{};
+                }
+                return detail::invoke_optional(std::forward<decltype(fn)>(fn), m_value);
+            }
+        }
+
+        /**
+         * @brief Modify the wrapped value, then keep reading it under a shared lock, no writer in between.
+         *
+         * With a downgradable mutex (see concepts::DowngradableLockable) the exclusive lock turns into a
+         * shared lock, so that other readers proceed during the read. Other mutexes stay exclusively locked.
+         *
+         * @param write_fn The function to modify the value with.
+         * @param read_fn The function to read the modified value with.
+         * @param site The call site recorded by tracing and the watchdog, when compiled in.
+         *
+         * @return The return value of read_fn.
+         */
+        [[nodiscard]] decltype(auto) write_then_read(
+            std::invocable<T&> auto&&       write_fn,
+            std::invocable<const T&> auto&& read_fn,
+            detail::CallSite                site = detail::CallSite::current()
+        )
+        {
+            static_assert(
+                not std::is_lvalue_reference_v<decltype(read_fn(std::as_const(m_value)))>,
+                "Function returning a reference in multithreaded context is dangerous! Consider copying "
+                "instead."
+            );
+
+            auto notify = notify_write();
+            auto trace  = trace_write(site);
+            auto lock   = lock_write();
+            trace.acquired();
+            std::invoke(std::forward<decltype(write_fn)>(write_fn), m_value);
+
+            if constexpr (concepts::DowngradableLockable<Mutex>) {
+                lock.release()->unlock_and_lock_shared();
+                auto shared = std::shared_lock{ mutex(), std::adopt_lock };
+                return std::forward<decltype(read_fn)>(read_fn)(std::as_const(m_value));
+            } else {
+                return std::forward<decltype(read_fn)>(read_fn)(std::as_const(m_value));
+            }
+        }
+
+        /**
+         * @brief Access the wrapped value in a read-only context, only if the lock is free right now.
+         *
+         * @param fn The function to call with the value.
+         *
+         * @return The return value of the function (or true if it returns void), empty if the lock is busy.
+         */
+        [[nodiscard]] auto try_read(std::invocable<const T&> auto&& fn) const
+        {
+            auto lock = lock_read(std::try_to_lock);
+            return invoke_locked(lock, std::forward<decltype(fn)>(fn), m_value);
+        }
+
+        /**
+         * @brief Access the wrapped value in a read-write context, only if the lock is free right now.
+         *
+         * @param fn The function to call with the value.
+         *
+         * @return The return value of the function (or true if it returns void), empty if the lock is busy.
+         */
+        [[nodiscard]] auto try_write(std::invocable<T&> auto&& fn)
+        {
+            auto notify = notify_write();
+            auto lock   = lock_write(std::try_to_lock);
+            if (not lock.owns_lock()) {
+                notify.dismiss();
+            }
+            return invoke_locked(lock, std::forward<decltype(fn)>(fn), m_value);
+        }
+
+        /**
+         * @brief Access the wrapped value in a read-only context, give up if the lock is not free in time.
+         *
+         * Timed mutexes wait on the mutex itself, other mutexes are polled with backoff.
+         *
+         * @param timeout The maximum time to wait for the lock.
+         * @param fn The function to call with the value.
+         *
+         * @return The return value of the function (or true if it returns void), empty on timeout.
+         */
+        template <typename Rep, typename Period>
+        [[nodiscard]] auto read_for(
+            const std::chrono::duration<Rep, Period>& timeout,
+            std::invocable<const T&> auto&&           fn
+        ) const
+        {
+            return read_until(std::chrono::steady_clock::now() + timeout, std::forward<decltype(fn)>(fn));
+        }
+
+        /**
+         * @brief Access the wrapped value in a read-only context, give up if the lock is not free in time.
+         *
+         * Timed mutexes wait on the mutex itself, other mutexes are polled with backoff.
+         *
+         * @param deadline The time point after which to stop waiting for the lock.
+         * @param fn The function to call with the value.
+         *
+         * @return The return value of the function (or true if it returns void), empty on timeout.
+         */
+        template <typename Clock, typename Duration>
+        [[nodiscard]] auto read_until(
+            const std::chrono::time_point<Clock, Duration>& deadline,
+            std::invocable<const T&> auto&&                 fn
+        ) const
+        {
+            auto lock = lock_read(std::defer_lock);
+            detail::acquire(lock, deadline);
+            return invoke_locked(lock, std::forward<decltype(fn)>(fn), m_value);
+        }
+
+        /**
+         * @brief Access the wrapped value in a read-write context, give up if the lock is not free in time.
+         *
+         * Timed mutexes wait on the mutex itself, other mutexes are polled with backoff.
+         *
+         * @param timeout The maximum time to wait for the lock.
+         * @param fn The function to call with the value.
+         *
+         * @return The return value of the function (or true if it returns void), empty on timeout.
+         */
+        template <typename Rep, typename Period>
+        [[nodiscard]] auto write_for(
+            const std::chrono::duration<Rep, Period>& timeout,
+            std::invocable<T&> auto&&                 fn
+        )
+        {
+            return write_until(std::chrono::steady_clock::now() + timeout, std::forward<decltype(fn)>(fn));
+        }
+
+        /**
+         * @brief Access the wrapped value in a read-write context, give up if the lock is not free in time.
+         *
+         * Timed mutexes wait on the mutex itself, other mutexes are polled with backoff.
+         *
+         * @param deadline The time point after which to stop waiting for the lock.
+         * @param fn The function to call with the value.
+         *
+         * @return The return value of the function (or true if it returns void), empty on timeout.
+         */
+        template <typename Clock, typename Duration>
+        [[nodiscard]] auto write_until(
+            const std::chrono::time_point<Clock, Duration>& deadline,
+            std::invocable<T&> auto&&                       fn
+        )
+        {
+            auto notify = notify_write();
+            auto lock   = lock_write(std::defer_lock);
+            if (not detail::acquire(lock, deadline)) {
+                notify.dismiss();
+            }
+            return invoke_locked(lock, std::forward<decltype(fn)>(fn), m_value);
+        }
+
+        /**
+         * @brief Access the wrapped value in a read-only context, give up waiting when a stop is requested.
+         *
+         * @param token The stop token to abandon the wait with.
+         * @param fn The function to call with the value.
+         *
+         * @return The return value of the function (or true if it returns void), empty if stopped.
+         */
+        [[nodiscard]] auto read(std::stop_token token, std::invocable<const T&> auto&& fn) const
+        {
+            auto lock = lock_read(std::defer_lock);
+            detail::acquire(lock, token);
+            return invoke_locked(lock, std::forward<decltype(fn)>(fn), m_value);
+        }
+
+        /**
+         * @brief Access the wrapped value in a read-write context, give up waiting when a stop is requested.
+         *
+         * @param token The stop token to abandon the wait with.
+         * @param fn The function to call with the value.
+         *
+         * @return The return value of the function (or true if it returns void), empty if stopped.
+         */
+        [[nodiscard]] auto write(std::stop_token token, std::invocable<T&> auto&& fn)
+        {
+            auto notify = notify_write();
+            auto lock   = lock_write(std::defer_lock);
+            if (not detail::acquire(lock, token)) {
+                notify.dismiss();
+            }
+            return invoke_locked(lock, std::forward<decltype(fn)>(fn), m_value);
+        }
+
+        /**
+         * @brief Wait until a condition holds on the wrapped value, then access it in a read-only context.
+         *
+         * The condition is checked under the lock, and checked again after every write to the object (see
+         * "Waiting for a condition" in the README). The waiting thread parks on a process-wide wait table
+         * instead of a condition variable, so the writes only pay for a notification when someone waits.
+         *
+         * @param pred The condition on the value.
+         * @param fn The function to call with the value once the condition holds, in the same lock.
+         *
+         * @return The return value of the function.
+         */
+        template <std::predicate<const T&> Pred, std::invocable<const T&> Fn>
+        [[nodiscard]] auto wait_read(Pred&& pred, Fn&& fn) const -> std::invoke_result_t<Fn, const T&>
+        {
+            auto result = invoke_when(
+                [this](auto tag) { return lock_read(tag); },
+                std::forward<Pred>(pred),
+                std::forward<Fn>(fn),
+                std::as_const(m_value),
+                std::nullopt
+            );
+            if constexpr (not std::is_void_v<std::invoke_result_t<Fn, const T&>>) {
+                return std::move(*result);
+            }
+        }
+
+        /**
+         * @brief Wait until a condition holds on the wrapped value, then access it in a read-write context.
+         *
+         * Like wait_read(), the waiters of this object are notified once the function has run.
+         *
+         * @param pred The condition on the value.
+         * @param fn The function to call with the value once the condition holds, in the same lock.
+         *
+         * @return The return value of the function.
+         */
+        template <std::predicate<const T&> Pred, std::invocable<T&> Fn>
+        [[nodiscard]] auto wait_write(Pred&& pred, Fn&& fn) -> std::invoke_result_t<Fn, T&>
+        {
+            auto notify = notify_write();
+            auto result = invoke_when(
+                [this](auto tag) { return lock_write(tag); },
+                std::forward<Pred>(pred),
+                std::forward<Fn>(fn),
+                m_value,
+                std::nullopt
+            );
+            if constexpr (not std::is_void_v<std::invoke_result_t<Fn, T&>>) {
+                return std::move(*result);
+            }
+        }
+
+        /**
+         * @brief Wait until a condition holds on the wrapped value, then access it in a read-only context;
+         * give up if it does not hold in time.
+         *
+         * @param timeout The maximum time to wait for the condition (and the lock).
+         * @param pred The condition on the value.
+         * @param fn The function to call with the value once the condition holds, in the same lock.
+         *
+         * @return The return value of the function (or true if it returns void), empty on timeout.
+         */
+        template <typename Rep, typename Period>
+        [[nodiscard]] auto wait_read_for(
+            const std::chrono::duration<Rep, Period>& timeout,
+            std::predicate<const T&> auto&&           pred,
+            std::invocable<const T&> auto&&           fn
+        ) const
+        {
+            return wait_read_until(
+                std::chrono::steady_clock::now() + timeout,
+                std::forward<decltype(pred)>(pred),
+                std::forward<decltype(fn)>(fn)
+            );
+        }
+
+        /**
+         * @brief Wait until a condition holds on the wrapped value, then access it in a read-only context;
+         * give up if it does not hold in time.
+         *
+         * @param deadline The time point after which to stop waiting for the condition (and the lock).
+         * @param pred The condition on the value.
+         * @param fn The function to call with the value once the condition holds, in the same lock.
+         *
+         * @return The return value of the function (or true if it returns void), empty on timeout.
+         */
+        template <typename Clock, typename Duration>
+        [[nodiscard]] auto wait_read_until(
+            const std::chrono::time_point<Clock, Duration>& deadline,
+            std::predicate<const T&> auto&&                 pred,
+            std::invocable<const T&> auto&&                 fn
+        ) const
+        {
+            return invoke_when(
+                [this](auto tag) { return lock_read(tag); },
+                std::forward<decltype(pred)>(pred),
+                std::forward<decltype(fn)>(fn),
+                std::as_const(m_value),
+                detail::to_steady(deadline)
+            );
+        }
+
+        /**
+         * @brief Wait until a condition holds on the wrapped value, then access it in a read-write context;
+         * give up if it does not hold in time.
+         *
+         * @param timeout The maximum time to wait for the condition (and the lock).
+         * @param pred The condition on the value.
+         * @param fn The function to call with the value once the condition holds, in the same lock.
+         *
+         * @return The return value of the function (or true if it returns void), empty on timeout.
+         */
+        template <typename Rep, typename Period>
+        [[nodiscard]] auto wait_write_for(
+            const std::chrono::duration<Rep, Period>& timeout,
+            std::predicate<const T&> auto&&           pred,
+            std::invocable<T&> auto&&                 fn
+        )
+        {
+            return wait_write_until(
+                std::chrono::steady_clock::now() + timeout,
+                std::forward<decltype(pred)>(pred),
+                std::forward<decltype(fn)>(fn)
+            );
+        }
+
+        /**
+         * @brief Wait until a condition holds on the wrapped value, then access it in a read-write context;
+         * give up if it does not hold in time.
+         *
+         * @param deadline The time point after which to stop waiting for the condition (and the lock).
+         * @param pred The condition on the value.
+         * @param fn The function to call with the value once the condition holds, in the same lock.
+         *
+         * @return The return value of the function (or true if it returns void), empty on timeout.
+         */
+        template <typename Clock, typename Duration>
+        [[nodiscard]] auto wait_write_until(
+            const std::chrono::time_point<Clock, Duration>& deadline,
+            std::predicate<const T&> auto&&                 pred,
+            std::invocable<T&> auto&&                       fn
+        )
+        {
+            auto notify = notify_write();
+            auto result = invoke_when(
+                [this](auto tag) { return lock_write(tag); },
+                std::forward<decltype(pred)>(pred),
+                std::forward<decltype(fn)>(fn),
+                m_value,
+                detail::to_steady(deadline)
+            );
+            if (not result) {
+                notify.dismiss();
+            }
+            return result;
+        }
+
+        /**
+         * @brief Get notified of the changes of the wrapped value, outside of the lock.
+         *
+         * The callback is called on the notifier thread with a copy of the value, first with the current
+         * value, then after the writes (see "Subscriptions" in the README). The writes until a delivery make
+         * a single notification, of the latest value; a writer only queues the subscription, so slow
+         * callbacks never hold it up. The callbacks must not throw. Requires sync_cpp/subscription.hpp.
+         *
+         * @param fn The callback to call with the copy of the value.
+         *
+         * @return The subscription (spp::Subscription), the callback is called until it's destroyed.
+         */
+        [[nodiscard]] auto subscribe(std::invocable<const T&> auto&& fn) const
+            requires std::copy_constructible<T>
+        {
+            return subscribe([](const T& value) { return value; }, std::forward<decltype(fn)>(fn));
+        }
+
+        /**
+         * @brief Get notified of the changes of the wrapped value, outside of the lock.
+         *
+         * Like subscribe(fn), but the snapshot is made by a projection of the value (run under the shared
+         * lock), e.g. the one field the subscriber cares about instead of a copy of a whole container.
+         *
+         * @param project The function making the snapshot from the value.
+         * @param fn The callback to call with the snapshot.
+         *
+         * @return The subscription (spp::Subscription), the callback is called until it's destroyed.
+         */
+        template <std::invocable<const T&> Project, typename Fn>
+            requires std::invocable<Fn&, const std::invoke_result_t<Project&, const T&>&>
+        [[nodiscard]] auto subscribe(Project&& project, Fn&& fn) const
+        {
+            static_assert(
+                not std::is_reference_v<std::invoke_result_t<Project&, const T&>>,
+                "The snapshot is read outside of the lock, it must be a copy."
+            );
+
+            auto deliver = [this,
+                            project = std::forward<Project>(project),
+                            fn      = std::forward<Fn>(fn)]() mutable {
+                auto snapshot = read([&](const T& value) { return std::invoke(project, value); });
+                std::invoke(fn, std::as_const(snapshot));
+            };
+            return detail::subscribe(&m_value, std::move(deliver));
+        }
+
         /**
          * @brief Assign a new value to the wrapped object.
          *
@@ -221,6 +771,15 @@ namespace spp
          */
         void swap(Sync& other)
         {
+            auto notify       = notify_write();
+            auto notify_other = other.notify_write();
+
+            if (&mutex() == &other.mutex()) {
+                auto lock = std::unique_lock{ mutex() };
+                std::swap(m_value, other.m_value);
+                return;
+            }
+
             auto lock1 = std::unique_lock{ mutex(), std::defer_lock };
             auto lock2 = std::unique_lock{ other.mutex(), std::defer_lock };
 
@@ -234,7 +793,9 @@ namespace spp
          */
         Mutex& mutex() const
         {
-            if constexpr (std::is_pointer_v<UnderlyingMutex>) {
+            if constexpr (striped_mutex) {
+                return M::stripe_for(this);
+            } else if constexpr (std::is_pointer_v<UnderlyingMutex>) {
                 return *m_mutex;
             } else {
                 return m_mutex;
@@ -242,21 +803,118 @@ namespace spp
         }
 
     private:
-        using UnderlyingMutex = std::conditional_t<InternalMutex, Mutex, Mutex*>;
+        // the mutex is picked from a process-wide table, other objects may share it
+        static constexpr bool striped_mutex = concepts::StripedMutex<M>;
+
+        using UnderlyingMutex = std::conditional_t<
+            striped_mutex,
+            detail::NoMutex,
+            std::conditional_t<InternalMutex, Mutex, Mutex*>>;
 
-        [[nodiscard]] auto lock_read() const
+        static constexpr std::size_t value_alignment
+            = Layout == SyncLayout::Compact ? alignof(Value)
+                                            : std::max(alignof(Value), detail::cache_line_size);
+
+        static constexpr std::size_t mutex_alignment
+            = Layout == SyncLayout::Isolated and not striped_mutex
+                ? std::max(alignof(UnderlyingMutex), detail::cache_line_size)
+                : alignof(UnderlyingMutex);
+
+        [[nodiscard]] auto lock_read(auto... tag) const
         {
-            if constexpr (std::derived_from<M, std::shared_mutex>) {
-                return std::shared_lock{ mutex() };
+            if constexpr (concepts::SharedLockable<Mutex>) {
+                return std::shared_lock{ mutex(), tag... };
             } else {
-                return std::unique_lock{ mutex() };
+                return std::unique_lock{ mutex(), tag... };
             }
         }
 
-        [[nodiscard]] auto lock_write() { return std::unique_lock{ mutex() }; }
+        [[nodiscard]] auto lock_write(auto... tag) { return std::unique_lock{ mutex(), tag... }; }
+
+        // declared before the lock, so that the release is recorded after unlocking
+        [[nodiscard]] detail::TraceScope trace_read(const detail::CallSite& site) const
+        {
+            return { site, &mutex(), concepts::SharedLockable<Mutex> };
+        }
+
+        [[nodiscard]] detail::TraceScope trace_write(const detail::CallSite& site) const
+        {
+            return { site, &mutex(), false };
+        }
+
+        // declared before the lock, so that the waiters (see wait_read) and the subscribers are notified
+        // after unlocking
+        [[nodiscard]] detail::NotifyScope<1> notify_write() const
+        {
+            return detail::NotifyScope<1>{ &m_value };
+        }
+
+        // call fn with the value under the lock once pred holds on it, parking on the wait table between the
+        // checks; empty if the deadline passes first
+        static auto invoke_when(
+            auto&&                                                      lock,
+            auto&&                                                      pred,
+            auto&&                                                      fn,
+            auto&                                                       value,
+            const std::optional<std::chrono::steady_clock::time_point>& deadline
+        )
+        {
+            using Ret    = std::invoke_result_t<decltype(fn), decltype(value)>;
+            using Result = detail::OptionalResult<Ret>;
+
+            static_assert(
+                not std::is_lvalue_reference_v<Ret>,
+                "Function returning a reference in multithreaded context is dangerous! Consider copying "
+                "instead."
+            );
+
+            // registered after the first miss only, a condition that already holds costs no shared write
+            auto& bucket  = detail::WaitTable::bucket_for(&value);
+            auto  waiting = std::optional<detail::WaitRegistration>{};
+
+            while (true) {
+                auto epoch = bucket.m_epoch.load(std::memory_order_acquire);
+                {
+                    auto guard = lock(std::defer_lock);
+                    if (not deadline) {
+                        guard.lock();
+                    } else if (not detail::acquire(guard, *deadline)) {
+                        return Result{};
+                    }
+                    if (std::invoke(pred, std::as_const(value))) {
+                        return detail::invoke_optional(std::forward<decltype(fn)>(fn), value);
+                    }
+                }
+
+                if (not waiting) {
+                    waiting.emplace(bucket);    // a write may have slipped in before the registration
+                } else if (not deadline) {
+                    detail::WaitTable::wait(bucket, epoch);
+                } else if (not detail::WaitTable::wait(bucket, epoch, *deadline)) {
+                    return Result{};
+                }
+            }
+        }
+
+        // call fn with the value if the lock was acquired
+        static auto invoke_locked(const auto& lock, auto&& fn, auto& value)
+        {
+            using Result = detail::OptionalResult<std::invoke_result_t<decltype(fn), decltype(value)>>;
+
+            static_assert(
+                not std::is_lvalue_reference_v<std::invoke_result_t<decltype(fn), decltype(value)>>,
+                "Function returning a reference in multithreaded context is dangerous! Consider copying "
+                "instead."
+            );
+
+            if (not lock.owns_lock()) {
+                return Result{};
+            }
+            return detail::invoke_optional(std::forward<decltype(fn)>(fn), value);
+        }
 
-        Value                   m_value;
-        mutable UnderlyingMutex m_mutex;
+        alignas(value_alignment) Value                                         m_value;
+        [[no_unique_address]] alignas(mutex_alignment) mutable UnderlyingMutex m_mutex;
     };
 
     // deduction guide
@@ -0,0 +1,79 @@
+#ifndef SYNC_CPP_SYNC_ARRAY_HPP_A8YV3WGR
+#define SYNC_CPP_SYNC_ARRAY_HPP_A8YV3WGR
+
+#include "sync_cpp/sync.hpp"
+
+#include <array>
+#include <stdexcept>
+#include <utility>
+
+namespace spp
+{
+    /**
+     * @class SyncArray
+     *
+     * @brief A fixed-size array of Sync objects, each on its own cache line(s).
+     *
+     * Meant for per-thread (or per-worker) slots: neighbouring elements never share a cache line, so
+     * threads working on different elements don't slow each other down through false sharing.
+     *
+     * @tparam T The type of the object to wrap.
+     * @tparam N The number of elements.
+     * @tparam M The mutex type of each element.
+     */
+    template <concepts::Syncable T, std::size_t N, concepts::SyncMutex M = std::mutex>
+    class SyncArray
+    {
+    public:
+        using Element = Sync<T, M, true, SyncLayout::Padded>;
+        using Value   = T;
+        using Mutex   = typename Element::Mutex;
+
+        SyncArray() = default;
+
+        /**
+         * @brief Construct every element from the same arguments.
+         */
+        template <typename... Args>
+            requires std::constructible_from<T, const Args&...> and (sizeof...(Args) > 0)
+        explicit SyncArray(const Args&... args)
+            : SyncArray{ std::make_index_sequence<N>{}, args... }
+        {
+        }
+
+        Element&       operator[](std::size_t index) { return m_elements[index]; }
+        const Element& operator[](std::size_t index) const { return m_elements[index]; }
+
+        /**
+         * @brief Access an element with bounds checking.
+         *
+         * @throws std::out_of_range if index is out of range.
+         */
+        Element& at(std::size_t index) { return m_elements.at(index); }
+
+        /**
+         * @brief Access an element with bounds checking.
+         *
+         * @throws std::out_of_range if index is out of range.
+         */
+        const Element& at(std::size_t index) const { return m_elements.at(index); }
+
+        auto begin() { return m_elements.begin(); }
+        auto begin() const { return m_elements.begin(); }
+        auto end() { return m_elements.end(); }
+        auto end() const { return m_elements.end(); }
+
+        static constexpr std::size_t size() { return N; }
+
+    private:
+        template <std::size_t... Is, typename... Args>
+        SyncArray(std::index_sequence<Is...>, const Args&... args)
+            : m_elements{ { ((void)Is, Element{ args... })... } }
+        {
+        }
+
+        std::array<Element, N> m_elements;
+    };
+}
+
+#endif /* end of include guard: SYNC_CPP_SYNC_ARRAY_HPP_A8YV3WGR */
@@ -0,0 +1,185 @@
+#ifndef SYNC_CPP_SYNC_ASYNC_HPP_W8HC3LZN
+#define SYNC_CPP_SYNC_ASYNC_HPP_W8HC3LZN
+
+#include "sync_cpp/concepts.hpp"
+#include "sync_cpp/detail/optional_result.hpp"
+#include "sync_cpp/mutex/async_mutex.hpp"
+
+#include <concepts>
+#include <coroutine>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <type_traits>
+#include <utility>
+
+namespace spp
+{
+    /**
+     * @class SyncAsync
+     *
+     * @brief A wrapper around a class object for coroutines: waiting for the lock suspends the coroutine
+     * instead of blocking its thread.
+     *
+     * `co_await sync.async_read(fn)` and `co_await sync.async_write(fn)` take the shared or the exclusive
+     * lock of the async mutex, call the function with the value in the awaiting coroutine and return its
+     * result (or rethrow its exception). Readers hold the lock together, and the coroutines waiting for it
+     * are resumed by the releasing thread or through the executor of the mutex.
+     *
+     * The function must not suspend: the lock is held while it runs.
+     *
+     * @tparam T The type of the object to wrap.
+     * @tparam M The async shared mutex.
+     */
+    template <concepts::Syncable T, concepts::AsyncSharedLockable M = AsyncSharedMutex>
+    class SyncAsync
+    {
+    public:
+        using Value = T;
+        using Mutex = M;
+
+        SyncAsync(const SyncAsync&)            = delete;
+        SyncAsync& operator=(const SyncAsync&) = delete;
+        SyncAsync(SyncAsync&&)                 = delete;
+        SyncAsync& operator=(SyncAsync&&)      = delete;
+
+        // prevent class from being created using new and destructed using delete
+        static void* operator new(size_t)     = delete;
+        static void* operator new[](size_t)   = delete;
+        static void  operator delete(void*)   = delete;
+        static void  operator delete[](void*) = delete;
+
+        template <typename... Args>
+            requires std::constructible_from<T, Args...>
+        SyncAsync(Args&&... args)
+            : m_value{ std::forward<Args>(args)... }
+        {
+        }
+
+        /**
+         * @param executor Resumes the coroutines that waited for the lock (see AsyncSharedMutex::Executor).
+         * @param args The arguments to construct the value with.
+         */
+        template <typename Executor, typename... Args>
+            requires std::constructible_from<M, Executor> and std::constructible_from<T, Args...>
+        SyncAsync(Executor&& executor, Args&&... args)
+            : m_mutex{ std::forward<Executor>(executor) }
+            , m_value{ std::forward<Args>(args)... }
+        {
+        }
+
+        /**
+         * @brief Access the wrapped value in a read-only context, once the shared lock is held.
+         *
+         * @param fn The function to call with the value.
+         *
+         * @return An awaitable for the return value of the function.
+         */
+        template <std::invocable<const T&> Fn>
+        [[nodiscard]] auto async_read(Fn&& fn)
+        {
+            return Access<const T&, std::decay_t<Fn>>{ *this, std::forward<Fn>(fn) };
+        }
+
+        /**
+         * @brief Access the wrapped value in a read-write context, once the exclusive lock is held.
+         *
+         * @param fn The function to call with the value.
+         *
+         * @return An awaitable for the return value of the function.
+         */
+        template <std::invocable<T&> Fn>
+        [[nodiscard]] auto async_write(Fn&& fn)
+        {
+            return Access<T&, std::decay_t<Fn>>{ *this, std::forward<Fn>(fn) };
+        }
+
+        /**
+         * @brief Access the wrapped value in a read-only context if the shared lock is free, without waiting.
+         *
+         * @param fn The function to call with the value.
+         *
+         * @return The return value of the function (true if it returns void) if the lock was acquired.
+         */
+        template <std::invocable<const T&> Fn>
+        [[nodiscard]] auto try_read(Fn&& fn) const
+            -> detail::OptionalResult<std::invoke_result_t<Fn, const T&>>
+        {
+            if (not m_mutex.try_lock_shared()) {
+                return {};
+            }
+            auto lock = std::shared_lock{ m_mutex, std::adopt_lock };
+            return detail::invoke_optional(std::forward<Fn>(fn), std::as_const(m_value));
+        }
+
+        /**
+         * @brief Access the wrapped value in a read-write context if the lock is free, without waiting.
+         *
+         * @param fn The function to call with the value.
+         *
+         * @return The return value of the function (true if it returns void) if the lock was acquired.
+         */
+        template <std::invocable<T&> Fn>
+        [[nodiscard]] auto try_write(Fn&& fn) -> detail::OptionalResult<std::invoke_result_t<Fn, T&>>
+        {
+            if (not m_mutex.try_lock()) {
+                return {};
+            }
+            auto lock = std::unique_lock{ m_mutex, std::adopt_lock };
+            return detail::invoke_optional(std::forward<Fn>(fn), m_value);
+        }
+
+    private:
+        // the awaitable of an access, owns the function until it has run
+        template <typename Arg, typename Fn, typename Ret = std::invoke_result_t<Fn&, Arg>>
+        class [[nodiscard]] Access
+        {
+        public:
+            static_assert(
+                not std::is_lvalue_reference_v<Ret>,
+                "Function returning a reference in multithreaded context is dangerous! Consider copying "
+                "instead."
+            );
+
+            static constexpr bool shared = std::is_const_v<std::remove_reference_t<Arg>>;
+
+            Access(SyncAsync& sync, auto&& fn)
+                : m_sync{ sync }
+                , m_lock{ shared ? sync.m_mutex.lock_shared_async() : sync.m_mutex.lock_async() }
+                , m_fn{ std::forward<decltype(fn)>(fn) }
+            {
+            }
+
+            bool await_ready() { return m_lock.await_ready(); }
+            auto await_suspend(std::coroutine_handle<> handle) { return m_lock.await_suspend(handle); }
+
+            Ret await_resume()
+            {
+                m_lock.await_resume();
+                if constexpr (shared) {
+                    auto lock = std::shared_lock{ m_sync.m_mutex, std::adopt_lock };
+                    return std::invoke(m_fn, std::as_const(m_sync.m_value));
+                } else {
+                    auto lock = std::unique_lock{ m_sync.m_mutex, std::adopt_lock };
+                    return std::invoke(m_fn, m_sync.m_value);
+                }
+            }
+
+        private:
+            using LockAwaiter = decltype(std::declval<M&>().lock_async());
+
+            SyncAsync&  m_sync;
+            LockAwaiter m_lock;
+            Fn          m_fn;
+        };
+
+        mutable M m_mutex;
+        T         m_value;
+    };
+
+    // deduction guide
+    template <typename T>
+    SyncAsync(T) -> SyncAsync<T>;
+}
+
+#endif /* end of include guard: SYNC_CPP_SYNC_ASYNC_HPP_W8HC3LZN */
@@ -0,0 +1,260 @@
+#ifndef SYNC_CPP_SYNC_COMBINING_HPP_5RB0XV2M
+#define SYNC_CPP_SYNC_COMBINING_HPP_5RB0XV2M
+
+#include "sync_cpp/concepts.hpp"
+#include "sync_cpp/detail/hardware.hpp"
+#include "sync_cpp/detail/optional_result.hpp"
+#include "sync_cpp/detail/thread_index.hpp"
+#include "sync_cpp/mutex/backoff.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+namespace spp
+{
+    /**
+     * @class SyncCombining
+     *
+     * @brief A wrapper around a class object with flat combining, for objects that are written very often
+     * by many threads.
+     *
+     * A caller publishes its function in its own slot (one cache line per slot), then whichever thread gets
+     * the lock runs every published function in one batch while the value stays in its cache, and each
+     * caller picks up its own result (or exception). Waiters spin on their own slot with backoff, only trying
+     * the lock when no combiner is running, and fall back to blocking on the mutex after a while. A thread
+     * that finds its slot taken by another thread (more threads than slots) locks the mutex and runs its
+     * function itself.
+     *
+     * The function may run on another thread: it must not rely on thread-local state, and, like in Sync, it
+     * must not access the same object again.
+     *
+     * @tparam T The type of the object to wrap.
+     * @tparam M The mutex held by the combining thread.
+     * @tparam Slots The number of publication slots, threads are assigned to them by their thread index.
+     */
+    template <concepts::Syncable T, concepts::SyncMutex M = std::mutex, std::size_t Slots = 64>
+        requires concepts::Lockable<M> and (Slots > 0)
+    class SyncCombining
+    {
+    public:
+        using Value = T;
+        using Mutex = M;
+
+        SyncCombining(const SyncCombining&)            = delete;
+        SyncCombining& operator=(const SyncCombining&) = delete;
+        SyncCombining(SyncCombining&&)                 = delete;
+        SyncCombining& operator=(SyncCombining&&)      = delete;
+
+        // prevent class from being created using new and destructed using delete
+        static void* operator new(size_t)     = delete;
+        static void* operator new[](size_t)   = delete;
+        static void  operator delete(void*)   = delete;
+        static void  operator delete[](void*) = delete;
+
+        template <typename... Args>
+            requires std::constructible_from<T, Args...>
+        SyncCombining(Args&&... args)
+            : m_value{ std::forward<Args>(args)... }
+        {
+        }
+
+        /**
+         * @brief Get member object by copy.
+         *
+         * @tparam The type of the member object.
+         * @return Copy of the member object.
+         */
+        template <typename TT>
+        [[nodiscard]] TT get(TT T::* mem) const
+        {
+            return read([&](const T& value) { return value.*mem; });
+        }
+
+        /**
+         * @brief Access the wrapped value in a read-only context.
+         *
+         * Reads are combined with the writes, in the same batches.
+         *
+         * @param fn The function to call with the value.
+         *
+         * @return The return value of the function.
+         */
+        [[nodiscard]] decltype(auto) read(std::invocable<const T&> auto&& fn) const
+        {
+            return execute<const T&>(std::forward<decltype(fn)>(fn));
+        }
+
+        /**
+         * @brief Access the wrapped value in a read-write context.
+         *
+         * @param fn The function to call with the value.
+         *
+         * @return The return value of the function.
+         */
+        [[nodiscard]] decltype(auto) write(std::invocable<T&> auto&& fn)
+        {
+            return execute<T&>(std::forward<decltype(fn)>(fn));
+        }
+
+        /**
+         * @brief Assign a new value to the wrapped object.
+         *
+         * @tparam TT The type of the new value.
+         *
+         * @param value The new value to assign.
+         */
+        template <typename TT>
+            requires std::assignable_from<T&, TT>
+        SyncCombining& operator=(TT&& value)
+        {
+            write([&](T& v) { v = std::forward<TT>(value); });
+            return *this;
+        }
+
+    private:
+        static constexpr std::uint8_t free      = 0;
+        static constexpr std::uint8_t claimed   = 1;
+        static constexpr std::uint8_t published = 2;
+        static constexpr std::uint8_t done      = 3;
+
+        // rounds of spinning on the slot before blocking on the mutex
+        static constexpr int spin_limit = 64;
+
+        // passes over the slots of one batch, for the functions published while combining
+        static constexpr int combine_passes = 4;
+
+        // a type-erased call, lives on the caller's stack until it is done
+        struct Request
+        {
+            void (*m_run)(Request&, T&);
+            std::exception_ptr m_error = nullptr;
+        };
+
+        template <typename Arg, typename Fn>
+        struct Call : Request
+        {
+            using Ret = std::invoke_result_t<Fn, Arg>;
+
+            explicit Call(Fn& fn)
+                : Request{ &run }
+                , m_fn{ fn }
+            {
+            }
+
+            static void run(Request& request, T& value)
+            {
+                auto& self    = static_cast<Call&>(request);
+                self.m_result = detail::invoke_optional(std::forward<Fn>(self.m_fn), static_cast<Arg>(value));
+            }
+
+            Fn&                         m_fn;
+            detail::OptionalResult<Ret> m_result = {};
+        };
+
+        struct alignas(detail::cache_line_size) Slot
+        {
+            std::atomic<std::uint8_t> m_state   = free;
+            Request*                  m_request = nullptr;
+        };
+
+        // set while a thread combines, a waiter leaves the mutex alone until then
+        struct alignas(detail::cache_line_size) Combiner
+        {
+            std::atomic<bool> m_active = false;
+        };
+
+        template <typename Arg, typename Fn, typename Ret = std::invoke_result_t<Fn, Arg>>
+        Ret execute(Fn&& fn) const
+        {
+            static_assert(
+                not std::is_lvalue_reference_v<Ret>,
+                "Function returning a reference in multithreaded context is dangerous! Consider copying "
+                "instead."
+            );
+
+            auto call = Call<Arg, Fn>{ fn };
+            run(call);
+
+            if constexpr (not std::is_void_v<Ret>) {
+                return std::move(*call.m_result);
+            }
+        }
+
+        void run(Request& request) const
+        {
+            auto& slot     = m_slots[detail::thread_index() % Slots];
+            auto  expected = free;
+            if (not slot.m_state.compare_exchange_strong(expected, claimed, std::memory_order_acquire)) {
+                auto lock = std::unique_lock{ m_mutex };
+                request.m_run(request, m_value);
+                return;
+            }
+
+            slot.m_request = &request;
+            slot.m_state.store(published, std::memory_order_release);
+
+            auto backoff = backoff::Exponential<>{};
+            for (auto attempt = 0; slot.m_state.load(std::memory_order_acquire) != done; ++attempt) {
+                auto idle   = not m_combiner.m_active.load(std::memory_order_relaxed);
+                auto locked = attempt < spin_limit ? idle and m_mutex.try_lock() : (m_mutex.lock(), true);
+                if (locked) {
+                    combine();    // our request is published, so it's done after this
+                    m_mutex.unlock();
+                    break;
+                }
+                backoff();
+            }
+
+            slot.m_state.store(free, std::memory_order_release);
+            if (request.m_error) {
+                std::rethrow_exception(request.m_error);
+            }
+        }
+
+        // run every published request, the mutex is held
+        void combine() const noexcept
+        {
+            m_combiner.m_active.store(true, std::memory_order_relaxed);
+            for (auto pass = 0; pass < combine_passes; ++pass) {
+                auto served = false;
+                for (auto& slot : m_slots) {
+                    if (slot.m_state.load(std::memory_order_acquire) != published) {
+                        continue;
+                    }
+
+                    auto& request = *slot.m_request;
+                    try {
+                        request.m_run(request, m_value);
+                    } catch (...) {
+                        request.m_error = std::current_exception();
+                    }
+                    slot.m_state.store(done, std::memory_order_release);
+                    served = true;
+                }
+                if (not served) {
+                    break;
+                }
+            }
+            m_combiner.m_active.store(false, std::memory_order_relaxed);
+        }
+
+        // a read may combine the pending writes, so everything is mutable
+        mutable std::array<Slot, Slots> m_slots;
+        mutable Combiner                m_combiner;
+        mutable M                       m_mutex;
+        mutable T                       m_value;
+    };
+
+    // deduction guide
+    template <typename T>
+    SyncCombining(T) -> SyncCombining<T>;
+}
+
+#endif /* end of include guard: SYNC_CPP_SYNC_COMBINING_HPP_5RB0XV2M */
@@ -3,6 +3,9 @@
 
 #include "sync_cpp/sync.hpp"
 
+#include <chrono>
+#include <stop_token>
+
 namespace spp
 {
     /**
@@ -13,24 +16,28 @@ namespace spp
      * @tparam Container The type of the container object to wrap.
      * @tparam Element The element of the container object.
      * @tparam Getter The getter to access the element of the container object.
+     * @tparam Mtx The mutex type.
+     * @tparam InternalMutex Whether the mutex is stored inside the object or provided by the user.
+     * @tparam Layout The memory layout of the object, see SyncLayout.
      */
     template <
         typename Container,
         typename Element,
         concepts::Syncable  Getter,
         concepts::SyncMutex Mtx           = std::mutex,
-        bool                InternalMutex = true>
+        bool                InternalMutex = true,
+        SyncLayout          Layout        = SyncLayout::Compact>
         requires concepts::Transformer<Getter, Container&, Element&>                //
              and concepts::Transformer<Getter, const Container&, const Element&>    //
              and concepts::StatelessLambda<Getter>                                  //
              and concepts::Syncable<Element>                                        //
              and concepts::SyncMutex<Mtx>
-    class SyncContainer : public Sync<Container, Mtx, InternalMutex>
+    class SyncContainer : public Sync<Container, Mtx, InternalMutex, Layout>
     {
     public:
         using Value    = Container;
-        using Mutex    = Mtx;
-        using SyncBase = Sync<Container, Mtx, InternalMutex>;
+        using SyncBase = Sync<Container, Mtx, InternalMutex, Layout>;
+        using Mutex    = typename SyncBase::Mutex;
 
         template <typename... Args>
             requires std::constructible_from<Container, Args...> and InternalMutex
@@ -50,15 +57,20 @@ namespace spp
          * @brief Get the contained wrapped value's member by copy.
          *
          * @tparam TT [TODO:tparam]
+         * @param site The call site recorded by tracing and the watchdog, when compiled in.
          * @return [TODO:return]
          */
         template <typename TT>
-        [[nodiscard]] TT get_value(TT Element::* mem) const
+        [[nodiscard]] TT get_value(
+            TT Element::*    mem,
+            detail::CallSite site = detail::CallSite::current()
+        ) const
         {
-            return SyncBase::read([&](const Container& container) {
+            auto get = [&](const Container& container) {
                 decltype(auto) value = get_contained(container);
                 return value.*mem;
-            });
+            };
+            return SyncBase::read(get, site);
         }
 
         /**
@@ -77,10 +89,11 @@ namespace spp
             std::type_identity_t<Args>... args
         ) const
         {
-            return SyncBase::read([&](const Container& container) {
+            auto call = [&](const Container& container) {
                 decltype(auto) value = get_contained(container);
                 return (value.*fn)(std::forward<Args>(args)...);
-            });
+            };
+            return SyncBase::read(call, detail::CallSite{});
         }
 
         /**
@@ -99,10 +112,11 @@ namespace spp
             std::type_identity_t<Args>... args
         ) const
         {
-            return SyncBase::read([&](const Container& container) {
+            auto call = [&](const Container& container) {
                 decltype(auto) value = get_contained(container);
                 return (value.*fn)(std::forward<Args>(args)...);
-            });
+            };
+            return SyncBase::read(call, detail::CallSite{});
         }
 
         /**
@@ -121,10 +135,11 @@ namespace spp
             std::type_identity_t<Args>... args
         )
         {
-            return SyncBase::write([&](Container& container) {
+            auto call = [&](Container& container) {
                 decltype(auto) value = get_contained(container);
                 return (value.*fn)(std::forward<Args>(args)...);
-            });
+            };
+            return SyncBase::write(call, detail::CallSite{});
         }
 
         /**
@@ -143,37 +158,190 @@ namespace spp
             std::type_identity_t<Args>... args
         )
         {
-            return SyncBase::write([&](Container& container) {
+            auto call = [&](Container& container) {
                 decltype(auto) value = get_contained(container);
                 return (value.*fn)(std::forward<Args>(args)...);
-            });
+            };
+            return SyncBase::write(call, detail::CallSite{});
         }
 
         /**
          * @brief Access the contained wrapped value in a read-only context.
          *
          * @param fn The function to call with the value.
+         * @param site The call site recorded by tracing and the watchdog, when compiled in.
          *
          * @return The return value of the function.
          */
-        [[nodiscard]] decltype(auto) read_value(std::invocable<const Element&> auto&& fn) const
+        [[nodiscard]] decltype(auto) read_value(
+            std::invocable<const Element&> auto&& fn,
+            detail::CallSite                      site = detail::CallSite::current()
+        ) const
         {
-            return SyncBase::read([&](const Container& container) {
+            auto call = [&](const Container& container) {
                 decltype(auto) value = get_contained(container);
                 return fn(value);
-            });
+            };
+            return SyncBase::read(call, site);
         }
 
         /**
          * @brief Access the contained wrapped value in a read-write context.
          *
          * @param fn The function to call with the value.
+         * @param site The call site recorded by tracing and the watchdog, when compiled in.
          *
          * @return The return value of the function.
          */
-        [[nodiscard]] decltype(auto) write_value(std::invocable<Element&> auto&& fn)
+        [[nodiscard]] decltype(auto) write_value(
+            std::invocable<Element&> auto&& fn,
+            detail::CallSite                site = detail::CallSite::current()
+        )
+        {
+            auto call = [&](Container& container) {
+                decltype(auto) value = get_contained(container);
+                return fn(value);
+            };
+            return SyncBase::write(call, site);
+        }
+
+        /**
+         * @brief Access the contained wrapped value in a read-only context, only if the lock is free now.
+         *
+         * @param fn The function to call with the value.
+         *
+         * @return The return value of the function (or true if it returns void), empty if the lock is busy.
+         */
+        [[nodiscard]] auto try_read_value(std::invocable<const Element&> auto&& fn) const
+        {
+            return SyncBase::try_read([&](const Container& container) {
+                decltype(auto) value = get_contained(container);
+                return fn(value);
+            });
+        }
+
+        /**
+         * @brief Access the contained wrapped value in a read-write context, only if the lock is free now.
+         *
+         * @param fn The function to call with the value.
+         *
+         * @return The return value of the function (or true if it returns void), empty if the lock is busy.
+         */
+        [[nodiscard]] auto try_write_value(std::invocable<Element&> auto&& fn)
+        {
+            return SyncBase::try_write([&](Container& container) {
+                decltype(auto) value = get_contained(container);
+                return fn(value);
+            });
+        }
+
+        /**
+         * @brief Access the contained wrapped value in a read-only context, give up after a timeout.
+         *
+         * @param timeout The maximum time to wait for the lock.
+         * @param fn The function to call with the value.
+         *
+         * @return The return value of the function (or true if it returns void), empty on timeout.
+         */
+        template <typename Rep, typename Period>
+        [[nodiscard]] auto read_value_for(
+            const std::chrono::duration<Rep, Period>& timeout,
+            std::invocable<const Element&> auto&&     fn
+        ) const
+        {
+            return SyncBase::read_for(timeout, [&](const Container& container) {
+                decltype(auto) value = get_contained(container);
+                return fn(value);
+            });
+        }
+
+        /**
+         * @brief Access the contained wrapped value in a read-only context, give up at a deadline.
+         *
+         * @param deadline The time point after which to stop waiting for the lock.
+         * @param fn The function to call with the value.
+         *
+         * @return The return value of the function (or true if it returns void), empty on timeout.
+         */
+        template <typename Clock, typename Duration>
+        [[nodiscard]] auto read_value_until(
+            const std::chrono::time_point<Clock, Duration>& deadline,
+            std::invocable<const Element&> auto&&           fn
+        ) const
+        {
+            return SyncBase::read_until(deadline, [&](const Container& container) {
+                decltype(auto) value = get_contained(container);
+                return fn(value);
+            });
+        }
+
+        /**
+         * @brief Access the contained wrapped value in a read-write context, give up after a timeout.
+         *
+         * @param timeout The maximum time to wait for the lock.
+         * @param fn The function to call with the value.
+         *
+         * @return The return value of the function (or true if it returns void), empty on timeout.
+         */
+        template <typename Rep, typename Period>
+        [[nodiscard]] auto write_value_for(
+            const std::chrono::duration<Rep, Period>& timeout,
+            std::invocable<Element&> auto&&           fn
+        )
+        {
+            return SyncBase::write_for(timeout, [&](Container& container) {
+                decltype(auto) value = get_contained(container);
+                return fn(value);
+            });
+        }
+
+        /**
+         * @brief Access the contained wrapped value in a read-write context, give up at a deadline.
+         *
+         * @param deadline The time point after which to stop waiting for the lock.
+         * @param fn The function to call with the value.
+         *
+         * @return The return value of the function (or true if it returns void), empty on timeout.
+         */
+        template <typename Clock, typename Duration>
+        [[nodiscard]] auto write_value_until(
+            const std::chrono::time_point<Clock, Duration>& deadline,
+            std::invocable<Element&> auto&&                 fn
+        )
+        {
+            return SyncBase::write_until(deadline, [&](Container& container) {
+                decltype(auto) value = get_contained(container);
+                return fn(value);
+            });
+        }
+
+        /**
+         * @brief Access the contained wrapped value in a read-only context, give up on a stop request.
+         *
+         * @param token The stop token to abandon the wait with.
+         * @param fn The function to call with the value.
+         *
+         * @return The return value of the function (or true if it returns void), empty if stopped.
+         */
+        [[nodiscard]] auto read_value(std::stop_token token, std::invocable<const Element&> auto&& fn) const
+        {
+            return SyncBase::read(std::move(token), [&](const Container& container) {
+                decltype(auto) value = get_contained(container);
+                return fn(value);
+            });
+        }
+
+        /**
+         * @brief Access the contained wrapped value in a read-write context, give up on a stop request.
+         *
+         * @param token The stop token to abandon the wait with.
+         * @param fn The function to call with the value.
+         *
+         * @return The return value of the function (or true if it returns void), empty if stopped.
+         */
+        [[nodiscard]] auto write_value(std::stop_token token, std::invocable<Element&> auto&& fn)
         {
-            return SyncBase::write([&](Container& container) {
+            return SyncBase::write(std::move(token), [&](Container& container) {
                 decltype(auto) value = get_contained(container);
                 return fn(value);
             });
@@ -38,13 +38,19 @@ namespace spp
         concepts::Syncable  T,
         concepts::SyncMutex Mtx           = std::mutex,
         bool                CheckedAccess = true,
-        bool                InternalMutex = true>
-    class SyncOpt
-        : public SyncContainer<std::optional<T>, T, SyncOptAccessor<CheckedAccess>, Mtx, InternalMutex>
+        bool                InternalMutex = true,
+        SyncLayout          Layout        = SyncLayout::Compact>
+    class SyncOpt : public SyncContainer<
+                        std::optional<T>,
+                        T,
+                        SyncOptAccessor<CheckedAccess>,
+                        Mtx,
+                        InternalMutex,
+                        Layout>
     {
     public:
         using SyncBase
-            = SyncContainer<std::optional<T>, T, SyncOptAccessor<CheckedAccess>, Mtx, InternalMutex>;
+            = SyncContainer<std::optional<T>, T, SyncOptAccessor<CheckedAccess>, Mtx, InternalMutex, Layout>;
 
         using Value   = typename SyncBase::Value;
         using Mutex   = typename SyncBase::Mutex;
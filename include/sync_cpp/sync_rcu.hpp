@@ -0,0 +1,345 @@
+#ifndef SYNC_CPP_SYNC_RCU_HPP_5DNQ0XA3
+#define SYNC_CPP_SYNC_RCU_HPP_5DNQ0XA3
+
+#include "sync_cpp/concepts.hpp"
+#include "sync_cpp/detail/hardware.hpp"
+#include "sync_cpp/detail/thread_index.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace spp
+{
+    /**
+     * @class SyncRcu
+     *
+     * @brief A wrapper around a class object using read-copy-update.
+     *
+     * Readers run on an immutable snapshot of the value without taking any lock, so they never wait for a
+     * writer. Writers (serialized by M) copy the current value, modify the copy and publish it; the old
+     * snapshot is reclaimed once no reader that could have seen it is still running (epoch-based
+     * reclamation). Best suited for large, read-mostly objects.
+     *
+     * A reader that finds every slot taken (more concurrent or nested reads than ReaderSlots) enters
+     * through a shared overflow counter instead; nothing is reclaimed while that counter is non-zero.
+     *
+     * @tparam T The type of the object to wrap.
+     * @tparam M The mutex used to serialize the writers.
+     * @tparam ReaderSlots The number of concurrent readers tracked without contention.
+     */
+    template <concepts::Syncable T, concepts::SyncMutex M = std::mutex, std::size_t ReaderSlots = 64>
+        requires std::copy_constructible<T> and concepts::Lockable<M> and (ReaderSlots > 0)
+    class SyncRcu
+    {
+    public:
+        using Value = T;
+        using Mutex = M;
+
+        SyncRcu(const SyncRcu&)            = delete;
+        SyncRcu& operator=(const SyncRcu&) = delete;
+        SyncRcu(SyncRcu&&)                 = delete;
+        SyncRcu& operator=(SyncRcu&&)      = delete;
+
+        // prevent class from being created using new and destructed using delete
+        static void* operator new(size_t)     = delete;
+        static void* operator new[](size_t)   = delete;
+        static void  operator delete(void*)   = delete;
+        static void  operator delete[](void*) = delete;
+
+        template <typename... Args>
+            requires std::constructible_from<T, Args...>
+        SyncRcu(Args&&... args)
+            : m_current{ new T{ std::forward<Args>(args)... } }
+        {
+        }
+
+        /**
+         * @brief Destroy the current and all the retired snapshots.
+         *
+         * NOTE: make sure that no thread is still reading from this object.
+         */
+        ~SyncRcu()
+        {
+            delete m_current.load(std::memory_order_relaxed);
+            for (auto& retired : m_retired) {
+                delete retired.m_value;
+            }
+        }
+
+        /**
+         * @brief Get member object by copy.
+         *
+         * @tparam The type of the member object.
+         * @return Copy of the member object.
+         */
+        template <typename TT>
+        [[nodiscard]] TT get(TT T::* mem) const
+        {
+            auto guard = ReadGuard{ *this };
+            return guard.m_value->*mem;
+        }
+
+        /**
+         * @brief Call a const member function of the current snapshot.
+         *
+         * @tparam Ret The return type of the member function.
+         * @tparam Args The parameter types of the member function.
+         *
+         * @param args The argument to the member function.
+         *
+         * @return The value of the call to the member function.
+         */
+        template <typename Ret, typename... Args>
+        [[nodiscard]] Ret read(Ret (T::*fn)(Args...) const, std::type_identity_t<Args>... args) const
+        {
+            static_assert(
+                not std::is_lvalue_reference_v<Ret>,
+                "Member function returning a reference in multithreaded context is dangerous! Consider "
+                "copying instead."
+            );
+
+            auto guard = ReadGuard{ *this };
+            return (guard.m_value->*fn)(std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Call a const member function of the current snapshot.
+         *
+         * @tparam Ret The return type of the member function.
+         * @tparam Args The parameter types of the member function.
+         *
+         * @param args The argument to the member function.
+         *
+         * @return The value of the call to the member function.
+         */
+        template <typename Ret, typename... Args>
+        [[nodiscard]] Ret read(Ret (T::*fn)(Args...) const noexcept, std::type_identity_t<Args>... args) const
+        {
+            static_assert(
+                not std::is_lvalue_reference_v<Ret>,
+                "Member function returning a reference in multithreaded context is dangerous! Consider "
+                "copying instead."
+            );
+
+            auto guard = ReadGuard{ *this };
+            return (guard.m_value->*fn)(std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Call a non-const member function on a new version of the value, then publish it.
+         *
+         * @tparam Ret The return type of the member function.
+         * @tparam Args The parameter types of the member function.
+         *
+         * @param args The argument to the member function.
+         *
+         * @return The value of the call to the member function.
+         */
+        template <typename Ret, typename... Args>
+        [[nodiscard]] Ret write(Ret (T::*fn)(Args...), std::type_identity_t<Args>... args)
+        {
+            return write([&](T& value) -> Ret { return (value.*fn)(std::forward<Args>(args)...); });
+        }
+
+        /**
+         * @brief Call a non-const member function on a new version of the value, then publish it.
+         *
+         * @tparam Ret The return type of the member function.
+         * @tparam Args The parameter types of the member function.
+         *
+         * @param args The argument to the member function.
+         *
+         * @return The value of the call to the member function.
+         */
+        template <typename Ret, typename... Args>
+        [[nodiscard]] Ret write(Ret (T::*fn)(Args...) noexcept, std::type_identity_t<Args>... args)
+        {
+            return write([&](T& value) -> Ret { return (value.*fn)(std::forward<Args>(args)...); });
+        }
+
+        /**
+         * @brief Access the current snapshot in a read-only context, never blocks.
+         *
+         * Reads may nest; a read that finds no free slot enters through the overflow counter.
+         *
+         * @param fn The function to call with the value.
+         *
+         * @return The return value of the function.
+         */
+        [[nodiscard]] decltype(auto) read(std::invocable<const T&> auto&& fn) const
+        {
+            static_assert(
+                not std::is_lvalue_reference_v<std::invoke_result_t<decltype(fn), const T&>>,
+                "Function returning a reference in multithreaded context is dangerous! Consider copying "
+                "instead"
+            );
+
+            auto guard = ReadGuard{ *this };
+            return std::forward<decltype(fn)>(fn)(std::as_const(*guard.m_value));
+        }
+
+        /**
+         * @brief Modify a copy of the current value, then publish it as the new snapshot.
+         *
+         * If the function throws, nothing is published.
+         *
+         * @param fn The function to call with the value.
+         *
+         * @return The return value of the function.
+         */
+        [[nodiscard]] decltype(auto) write(std::invocable<T&> auto&& fn)
+        {
+            using Ret = std::invoke_result_t<decltype(fn), T&>;
+
+            static_assert(
+                not std::is_lvalue_reference_v<Ret>,
+                "Function returning a reference in multithreaded context is dangerous! Consider copying "
+                "instead."
+            );
+
+            auto lock = std::unique_lock{ m_mutex };
+            auto next = std::make_unique<T>(*m_current.load(std::memory_order_relaxed));
+
+            if constexpr (std::is_void_v<Ret>) {
+                std::forward<decltype(fn)>(fn)(*next);
+                publish(std::move(next));
+            } else {
+                decltype(auto) result = std::forward<decltype(fn)>(fn)(*next);
+                publish(std::move(next));
+                return result;
+            }
+        }
+
+        /**
+         * @brief Assign a new value to the wrapped object.
+         *
+         * @tparam TT The type of the new value.
+         *
+         * @param value The new value to assign.
+         */
+        template <typename TT>
+            requires std::assignable_from<T&, TT>
+        SyncRcu& operator=(TT&& value)
+        {
+            write([&](T& v) { v = std::forward<TT>(value); });
+            return *this;
+        }
+
+    private:
+        using Epoch = std::uint64_t;
+
+        static constexpr Epoch inactive = 0;
+
+        struct alignas(detail::cache_line_size) Slot
+        {
+            std::atomic<Epoch> m_epoch = inactive;
+        };
+
+        struct alignas(detail::cache_line_size) Overflow
+        {
+            std::atomic<std::size_t> m_readers = 0;
+        };
+
+        struct Retired
+        {
+            const T* m_value;
+            Epoch    m_epoch;
+        };
+
+        // announces the reader in a free slot with the current epoch (or in the overflow counter if the slot
+        // is null), then loads the current snapshot
+        struct ReadGuard
+        {
+            const SyncRcu&      m_self;
+            std::atomic<Epoch>* m_slot;
+            const T*            m_value;
+
+            ReadGuard(const SyncRcu& self)
+                : m_self{ self }
+                , m_slot{ self.enter() }
+                , m_value{ self.m_current.load(std::memory_order_seq_cst) }
+            {
+            }
+
+            ~ReadGuard()
+            {
+                if (m_slot != nullptr) {
+                    m_slot->store(inactive, std::memory_order_release);
+                } else {
+                    m_self.m_overflow.m_readers.fetch_sub(1, std::memory_order_release);
+                }
+            }
+        };
+
+        // returns null if every slot is taken, the reader is then counted in the overflow counter
+        std::atomic<Epoch>* enter() const
+        {
+            auto start = detail::thread_index() % ReaderSlots;
+            for (auto i = 0u; i < ReaderSlots; ++i) {
+                auto& slot     = m_slots[(start + i) % ReaderSlots].m_epoch;
+                auto  expected = inactive;
+                auto  epoch    = m_epoch.load(std::memory_order_seq_cst);
+
+                if (slot.load(std::memory_order_relaxed) == inactive
+                    and slot.compare_exchange_strong(expected, epoch, std::memory_order_seq_cst)) {
+                    return &slot;
+                }
+            }
+            m_overflow.m_readers.fetch_add(1, std::memory_order_seq_cst);
+            return nullptr;
+        }
+
+        void publish(std::unique_ptr<T> next)
+        {
+            auto old   = m_current.exchange(next.release(), std::memory_order_seq_cst);
+            auto epoch = m_epoch.fetch_add(1, std::memory_order_seq_cst);
+            m_retired.push_back({ old, epoch });
+            reclaim();
+        }
+
+        // a snapshot retired at epoch e can only be observed by readers that entered at epoch <= e
+        // an overflow reader has no epoch, it may hold any snapshot retired while it is counted
+        void reclaim()
+        {
+            if (m_overflow.m_readers.load(std::memory_order_seq_cst) != 0) {
+                return;
+            }
+
+            auto oldest = std::numeric_limits<Epoch>::max();
+            for (const auto& slot : m_slots) {
+                if (auto epoch = slot.m_epoch.load(std::memory_order_seq_cst); epoch != inactive) {
+                    oldest = std::min(oldest, epoch);
+                }
+            }
+
+            auto free = [&](const Retired& retired) {
+                if (retired.m_epoch < oldest) {
+                    delete retired.m_value;
+                    return true;
+                }
+                return false;
+            };
+            std::erase_if(m_retired, free);
+        }
+
+        std::atomic<T*>                       m_current;
+        std::atomic<Epoch>                    m_epoch = 1;
+        mutable std::array<Slot, ReaderSlots> m_slots;
+        mutable Overflow                      m_overflow;
+        std::vector<Retired>                  m_retired;
+        M                                     m_mutex;
+    };
+
+    // deduction guide
+    template <typename T>
+    SyncRcu(T) -> SyncRcu<T>;
+}
+
+#endif /* end of include guard: SYNC_CPP_SYNC_RCU_HPP_5DNQ0XA3 */
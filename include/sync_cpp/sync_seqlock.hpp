@@ -0,0 +1,305 @@
+#ifndef SYNC_CPP_SYNC_SEQLOCK_HPP_T4M8ZQ1C
+#define SYNC_CPP_SYNC_SEQLOCK_HPP_T4M8ZQ1C
+
+#include "sync_cpp/concepts.hpp"
+#include "sync_cpp/detail/hardware.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <utility>
+
+namespace spp
+{
+    /**
+     * @class SyncSeqlock
+     *
+     * @brief A wrapper around a trivially copyable class object with a seqlock.
+     *
+     * Readers never write to shared memory: they copy the value optimistically and retry if a writer was
+     * active in the meantime, then run the given function on the (consistent) copy. Writers are serialized
+     * with a mutex. Best suited for small values that are read very often and written rarely.
+     *
+     * @tparam T The type of the object to wrap.
+     * @tparam M The mutex used to serialize the writers.
+     */
+    template <concepts::SeqlockSyncable T, concepts::SyncMutex M = std::mutex>
+        requires concepts::Lockable<M>
+    class SyncSeqlock
+    {
+    public:
+        using Value = T;
+        using Mutex = M;
+
+        SyncSeqlock(const SyncSeqlock&)            = delete;
+        SyncSeqlock& operator=(const SyncSeqlock&) = delete;
+        SyncSeqlock(SyncSeqlock&&)                 = delete;
+        SyncSeqlock& operator=(SyncSeqlock&&)      = delete;
+
+        // prevent class from being created using new and destructed using delete
+        static void* operator new(size_t)     = delete;
+        static void* operator new[](size_t)   = delete;
+        static void  operator delete(void*)   = delete;
+        static void  operator delete[](void*) = delete;
+
+        template <typename... Args>
+            requires std::constructible_from<T, Args...>
+        SyncSeqlock(Args&&... args)
+        {
+            store(T{ std::forward<Args>(args)... });
+        }
+
+        /**
+         * @brief Get a consistent copy of the wrapped value.
+         */
+        [[nodiscard]] T load() const
+        {
+            auto buffer = Buffer{};
+            while (true) {
+                auto seq = m_seq.load(std::memory_order_acquire);
+                if (seq & 1) {
+                    detail::cpu_relax();
+                    continue;
+                }
+
+                for (auto i = 0u; i < word_count; ++i) {
+                    buffer.m_words[i] = m_words[i].load(std::memory_order_relaxed);
+                }
+
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (m_seq.load(std::memory_order_relaxed) == seq) {
+                    break;
+                }
+            }
+            return buffer.value();
+        }
+
+        /**
+         * @brief Get member object by copy.
+         *
+         * @tparam The type of the member object.
+         * @return Copy of the member object.
+         */
+        template <typename TT>
+        [[nodiscard]] TT get(TT T::* mem) const
+        {
+            return load().*mem;
+        }
+
+        /**
+         * @brief Call a const member function of a consistent copy of the wrapped value.
+         *
+         * @tparam Ret The return type of the member function.
+         * @tparam Args The parameter types of the member function.
+         *
+         * @param args The argument to the member function.
+         *
+         * @return The value of the call to the member function.
+         */
+        template <typename Ret, typename... Args>
+        [[nodiscard]] Ret read(Ret (T::*fn)(Args...) const, std::type_identity_t<Args>... args) const
+        {
+            static_assert(
+                not std::is_lvalue_reference_v<Ret>,
+                "Member function returning a reference to a copy is dangerous! Consider copying instead."
+            );
+
+            const auto value = load();
+            return (value.*fn)(std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Call a const member function of a consistent copy of the wrapped value.
+         *
+         * @tparam Ret The return type of the member function.
+         * @tparam Args The parameter types of the member function.
+         *
+         * @param args The argument to the member function.
+         *
+         * @return The value of the call to the member function.
+         */
+        template <typename Ret, typename... Args>
+        [[nodiscard]] Ret read(Ret (T::*fn)(Args...) const noexcept, std::type_identity_t<Args>... args) const
+        {
+            static_assert(
+                not std::is_lvalue_reference_v<Ret>,
+                "Member function returning a reference to a copy is dangerous! Consider copying instead."
+            );
+
+            const auto value = load();
+            return (value.*fn)(std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Call a non-const member function of the wrapped value.
+         *
+         * @tparam Ret The return type of the member function.
+         * @tparam Args The parameter types of the member function.
+         *
+         * @param args The argument to the member function.
+         *
+         * @return The value of the call to the member function.
+         */
+        template <typename Ret, typename... Args>
+        [[nodiscard]] Ret write(Ret (T::*fn)(Args...), std::type_identity_t<Args>... args)
+        {
+            return write([&](T& value) -> Ret { return (value.*fn)(std::forward<Args>(args)...); });
+        }
+
+        /**
+         * @brief Call a non-const member function of the wrapped value.
+         *
+         * @tparam Ret The return type of the member function.
+         * @tparam Args The parameter types of the member function.
+         *
+         * @param args The argument to the member function.
+         *
+         * @return The value of the call to the member function.
+         */
+        template <typename Ret, typename... Args>
+        [[nodiscard]] Ret write(Ret (T::*fn)(Args...) noexcept, std::type_identity_t<Args>... args)
+        {
+            return write([&](T& value) -> Ret { return (value.*fn)(std::forward<Args>(args)...); });
+        }
+
+        /**
+         * @brief Access a consistent copy of the wrapped value in a read-only context.
+         *
+         * The function is called exactly once, outside of any lock.
+         *
+         * @param fn The function to call with the value.
+         *
+         * @return The return value of the function.
+         */
+        [[nodiscard]] decltype(auto) read(std::invocable<const T&> auto&& fn) const
+        {
+            static_assert(
+                not std::is_lvalue_reference_v<std::invoke_result_t<decltype(fn), const T&>>,
+                "Function returning a reference to a copy is dangerous! Consider copying instead."
+            );
+
+            const auto value = load();
+            return std::forward<decltype(fn)>(fn)(value);
+        }
+
+        /**
+         * @brief Access the wrapped value in a read-write context.
+         *
+         * Concurrent readers will retry until the write completes.
+         *
+         * @param fn The function to call with the value.
+         *
+         * @return The return value of the function.
+         */
+        [[nodiscard]] decltype(auto) write(std::invocable<T&> auto&& fn)
+        {
+            static_assert(
+                not std::is_lvalue_reference_v<std::invoke_result_t<decltype(fn), T&>>,
+                "Function returning a reference in multithreaded context is dangerous! Consider copying "
+                "instead."
+            );
+
+            auto lock  = std::unique_lock{ m_mutex };
+            auto guard = WriteGuard{ *this };
+            return std::forward<decltype(fn)>(fn)(guard.m_value);
+        }
+
+        /**
+         * @brief Assign a new value to the wrapped object.
+         *
+         * @tparam TT The type of the new value.
+         *
+         * @param value The new value to assign.
+         */
+        template <typename TT>
+            requires std::assignable_from<T&, TT>
+        SyncSeqlock& operator=(TT&& value)
+        {
+            write([&](T& v) { v = std::forward<TT>(value); });
+            return *this;
+        }
+
+    private:
+        using Word = std::size_t;
+
+        static constexpr std::size_t word_count = (sizeof(T) + sizeof(Word) - 1) / sizeof(Word);
+
+        struct Buffer
+        {
+            alignas(T) alignas(Word) Word m_words[word_count];
+
+            // the memcpy implicitly creates the T object inside the buffer (T is trivially copyable)
+            T value() const
+            {
+                alignas(T) std::byte bytes[sizeof(m_words)];
+                std::memcpy(bytes, m_words, sizeof(m_words));
+                return *std::launder(reinterpret_cast<const T*>(bytes));
+            }
+
+            void assign(const T& value)
+            {
+                std::memcpy(m_words, &value, sizeof(T));
+            }
+        };
+
+        // reads the current value into a private copy, publishes it back on destruction
+        struct WriteGuard
+        {
+            SyncSeqlock& m_self;
+            T            m_value;
+
+            WriteGuard(SyncSeqlock& self)
+                : m_self{ self }
+                , m_value{ self.begin_write() }
+            {
+            }
+
+            ~WriteGuard() { m_self.end_write(m_value); }
+        };
+
+        T begin_write()
+        {
+            auto seq = m_seq.load(std::memory_order_relaxed);
+            m_seq.store(seq + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+
+            auto buffer = Buffer{};
+            for (auto i = 0u; i < word_count; ++i) {
+                buffer.m_words[i] = m_words[i].load(std::memory_order_relaxed);
+            }
+            return buffer.value();
+        }
+
+        void end_write(const T& value)
+        {
+            auto buffer = Buffer{};
+            buffer.assign(value);
+            for (auto i = 0u; i < word_count; ++i) {
+                m_words[i].store(buffer.m_words[i], std::memory_order_relaxed);
+            }
+            m_seq.store(m_seq.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        }
+
+        void store(const T& value)
+        {
+            auto buffer = Buffer{};
+            buffer.assign(value);
+            for (auto i = 0u; i < word_count; ++i) {
+                m_words[i].store(buffer.m_words[i], std::memory_order_relaxed);
+            }
+        }
+
+        std::atomic<std::size_t>                  m_seq = 0;
+        std::array<std::atomic<Word>, word_count> m_words;
+        M                                         m_mutex;
+    };
+
+    // deduction guide
+    template <typename T>
+    SyncSeqlock(T) -> SyncSeqlock<T>;
+}
+
+#endif /* end of include guard: SYNC_CPP_SYNC_SEQLOCK_HPP_T4M8ZQ1C */
@@ -0,0 +1,239 @@
+#ifndef SYNC_CPP_SYNC_SHARDED_MAP_HPP_QO3C8N6Y
+#define SYNC_CPP_SYNC_SHARDED_MAP_HPP_QO3C8N6Y
+
+#include "sync_cpp/sync.hpp"
+#include "sync_cpp/detail/optional_result.hpp"
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace spp
+{
+    /**
+     * @class SyncShardedMap
+     *
+     * @brief A lock-striped hash map: keys are hashed into independently locked Sync shards.
+     *
+     * Operations on keys that live in different shards never contend (each shard sits on its own cache
+     * line(s), so they don't falsely share either). Whole-map operations lock every shard in index order, so
+     * they see a consistent view of the map and can't deadlock with each other.
+     *
+     * @tparam K The key type.
+     * @tparam V The mapped type.
+     * @tparam Shards The number of shards.
+     * @tparam Hash The hash function for the key.
+     * @tparam KeyEqual The equality comparison for the key.
+     * @tparam M The mutex type of each shard.
+     */
+    template <
+        typename K,
+        typename V,
+        std::size_t         Shards = 16,
+        typename Hash              = std::hash<K>,
+        typename KeyEqual          = std::equal_to<K>,
+        concepts::SyncMutex M      = std::shared_mutex>
+        requires (Shards > 0)
+    class SyncShardedMap
+    {
+    public:
+        using Key    = K;
+        using Mapped = V;
+        using Map    = std::unordered_map<K, V, Hash, KeyEqual>;
+        using Shard  = Sync<Map, M, true, SyncLayout::Padded>;
+
+        SyncShardedMap() = default;
+
+        /**
+         * @brief Access the value of a key in a read-only context.
+         *
+         * @param key The key to look up.
+         * @param fn The function to call with the value.
+         *
+         * @return The return value of the function (or true if it returns void), empty if the key is absent.
+         */
+        [[nodiscard]] auto read(const K& key, std::invocable<const V&> auto&& fn) const
+        {
+            using Result = detail::OptionalResult<std::invoke_result_t<decltype(fn), const V&>>;
+
+            return shard_of(key).read([&](const Map& map) -> Result {
+                if (auto found = map.find(key); found != map.end()) {
+                    const auto& value = found->second;
+                    return detail::invoke_optional(std::forward<decltype(fn)>(fn), value);
+                }
+                return Result{};
+            });
+        }
+
+        /**
+         * @brief Access the value of a key in a read-write context.
+         *
+         * @param key The key to look up.
+         * @param fn The function to call with the value.
+         *
+         * @return The return value of the function (or true if it returns void), empty if the key is absent.
+         */
+        [[nodiscard]] auto write(const K& key, std::invocable<V&> auto&& fn)
+        {
+            using Result = detail::OptionalResult<std::invoke_result_t<decltype(fn), V&>>;
+
+            return shard_of(key).write([&](Map& map) -> Result {
+                if (auto found = map.find(key); found != map.end()) {
+                    return detail::invoke_optional(std::forward<decltype(fn)>(fn), found->second);
+                }
+                return Result{};
+            });
+        }
+
+        /**
+         * @brief Insert a value constructed from args if the key does not exist.
+         *
+         * @return Whether the insertion took place.
+         */
+        template <typename... Args>
+            requires std::constructible_from<V, Args...>
+        bool try_emplace(K key, Args&&... args)
+        {
+            return shard_of(key).write([&](Map& map) {
+                return map.try_emplace(std::move(key), std::forward<Args>(args)...).second;
+            });
+        }
+
+        /**
+         * @brief Remove a key from the map.
+         *
+         * @return Whether the key was present.
+         */
+        bool erase(const K& key)
+        {
+            return shard_of(key).write([&](Map& map) { return map.erase(key) > 0; });
+        }
+
+        /**
+         * @brief Check whether the map contains a key.
+         */
+        [[nodiscard]] bool contains(const K& key) const
+        {
+            return shard_of(key).read([&](const Map& map) { return map.contains(key); });
+        }
+
+        /**
+         * @brief Get the number of elements (a consistent snapshot, all shards are locked).
+         */
+        [[nodiscard]] std::size_t size() const
+        {
+            auto size = std::size_t{ 0 };
+            lock_all<const Map>(m_shards, [&](auto& maps) {
+                for (const auto* map : maps) {
+                    size += map->size();
+                }
+            });
+            return size;
+        }
+
+        /**
+         * @brief Remove every element of the map (all shards are locked at once).
+         */
+        void clear()
+        {
+            lock_all<Map>(m_shards, [](auto& maps) {
+                for (auto* map : maps) {
+                    map->clear();
+                }
+            });
+        }
+
+        /**
+         * @brief Iterate over a consistent view of the whole map in a read-only context.
+         *
+         * Every shard is locked (in index order) for the whole iteration.
+         *
+         * @param fn The function to call with each key and value.
+         */
+        void read_all(std::invocable<const K&, const V&> auto&& fn) const
+        {
+            lock_all<const Map>(m_shards, [&](auto& maps) {
+                for (const auto* map : maps) {
+                    for (const auto& [key, value] : *map) {
+                        fn(key, value);
+                    }
+                }
+            });
+        }
+
+        /**
+         * @brief Iterate over a consistent view of the whole map in a read-write context.
+         *
+         * Every shard is locked (in index order) for the whole iteration.
+         *
+         * @param fn The function to call with each key and value.
+         */
+        void write_all(std::invocable<const K&, V&> auto&& fn)
+        {
+            lock_all<Map>(m_shards, [&](auto& maps) {
+                for (auto* map : maps) {
+                    for (auto& [key, value] : *map) {
+                        fn(key, value);
+                    }
+                }
+            });
+        }
+
+        /**
+         * @brief Get the index of the shard a key belongs to.
+         */
+        [[nodiscard]] static std::size_t shard_index(const K& key)
+        {
+            // finalizer of murmur3, so that weak hashes (e.g. identity for integers) still spread evenly
+            auto hash = static_cast<std::uint64_t>(Hash{}(key));
+            hash ^= hash >> 33;
+            hash *= 0xFF51'AFD7'ED55'8CCD;
+            hash ^= hash >> 33;
+            return static_cast<std::size_t>(hash % Shards);
+        }
+
+        /**
+         * @brief Get a shard by its index.
+         */
+        Shard&       shard(std::size_t index) { return m_shards[index]; }
+        const Shard& shard(std::size_t index) const { return m_shards[index]; }
+
+        /**
+         * @brief Get the number of shards.
+         */
+        static constexpr std::size_t shard_count() { return Shards; }
+
+    private:
+        Shard&       shard_of(const K& key) { return m_shards[shard_index(key)]; }
+        const Shard& shard_of(const K& key) const { return m_shards[shard_index(key)]; }
+
+        // lock the shards one by one in index order (nested), then call fn with all the maps
+        template <typename MapT, typename ShardArray>
+        static void lock_all(ShardArray& shards, auto&& fn)
+        {
+            auto maps = std::array<MapT*, Shards>{};
+            auto step = [&](auto& self, std::size_t index) -> void {
+                if (index == Shards) {
+                    fn(maps);
+                } else if constexpr (std::is_const_v<MapT>) {
+                    shards[index].read([&](const Map& map) {
+                        maps[index] = &map;
+                        self(self, index + 1);
+                    });
+                } else {
+                    shards[index].write([&](Map& map) {
+                        maps[index] = &map;
+                        self(self, index + 1);
+                    });
+                }
+            };
+            step(step, 0);
+        }
+
+        std::array<Shard, Shards> m_shards;
+    };
+}
+
+#endif /* end of include guard: SYNC_CPP_SYNC_SHARDED_MAP_HPP_QO3C8N6Y */
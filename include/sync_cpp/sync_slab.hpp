@@ -0,0 +1,373 @@
+#ifndef SYNC_CPP_SYNC_SLAB_HPP_4VQN7EJX
+#define SYNC_CPP_SYNC_SLAB_HPP_4VQN7EJX
+
+#include "sync_cpp/concepts.hpp"
+#include "sync_cpp/detail/hardware.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace spp
+{
+    /**
+     * @class SyncSlab
+     *
+     * @brief A pool of Sync objects (Sync, SyncOpt, SyncSmartPtr, ...) stored densely in cache-aligned
+     * chunks, with stable addresses.
+     *
+     * The objects live in a few large chunks (each twice as big as the previous one) instead of one
+     * allocation each, so a scan over all of them walks memory in order. An object is identified by a
+     * handle (its index and the generation of its slot), which stays valid until the object is erased; the
+     * slot of an erased object is recycled through a lock-free free list, and a stale handle is detected.
+     *
+     * emplace() and erase() may be called concurrently, and so may the accesses to the objects (they are
+     * synchronized by themselves). An object must not be erased while another thread uses it, or while the
+     * slab is iterated.
+     *
+     * @tparam S The Sync type of the objects.
+     * @tparam ChunkSize The number of objects in the first chunk.
+     */
+    template <concepts::SyncDerivative S, std::size_t ChunkSize = 1024>
+        requires (ChunkSize > 0)
+    class SyncSlab
+    {
+    private:
+        struct Slot;
+
+    public:
+        using Element = S;
+        using Value   = typename S::Value;
+        using Mutex   = typename S::Mutex;
+
+        /**
+         * @class Handle
+         *
+         * @brief Identifies an object of the slab, stale once the object is erased.
+         */
+        struct Handle
+        {
+            std::uint32_t m_index      = 0;
+            std::uint32_t m_generation = 0;
+
+            friend bool operator==(const Handle&, const Handle&) = default;
+        };
+
+        /**
+         * @class Iterator
+         *
+         * @brief Visits the live objects in memory order.
+         */
+        template <bool Const>
+        class Iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = S;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = std::conditional_t<Const, const S*, S*>;
+            using reference         = std::conditional_t<Const, const S&, S&>;
+
+            Iterator() = default;
+
+            reference operator*() const { return *m_slab->slot(m_index)->object(); }
+            pointer   operator->() const { return m_slab->slot(m_index)->object(); }
+
+            Iterator& operator++()
+            {
+                m_index = m_slab->next_live(m_index + 1, m_end);
+                return *this;
+            }
+
+            Iterator operator++(int)
+            {
+                auto copy = *this;
+                ++*this;
+                return copy;
+            }
+
+            friend bool operator==(const Iterator& lhs, const Iterator& rhs)
+            {
+                return lhs.m_index == rhs.m_index;
+            }
+
+        private:
+            friend SyncSlab;
+
+            Iterator(const SyncSlab* slab, std::size_t index, std::size_t end)
+                : m_slab{ slab }
+                , m_index{ slab->next_live(index, end) }
+                , m_end{ end }
+            {
+            }
+
+            const SyncSlab* m_slab  = nullptr;
+            std::size_t     m_index = 0;
+            std::size_t     m_end   = 0;
+        };
+
+        SyncSlab() = default;
+
+        SyncSlab(const SyncSlab&)            = delete;
+        SyncSlab& operator=(const SyncSlab&) = delete;
+
+        ~SyncSlab()
+        {
+            for (auto& element : *this) {
+                std::destroy_at(&element);
+            }
+            for (auto k = 0u; k < max_chunks; ++k) {
+                if (auto* chunk = m_chunks[k].load(std::memory_order_relaxed)) {
+                    std::destroy_n(chunk, chunk_size(k));
+                    ::operator delete(chunk, std::align_val_t{ chunk_alignment });
+                }
+            }
+        }
+
+        /**
+         * @brief Construct an object in a free slot.
+         *
+         * @param args The arguments to construct the object with.
+         * @return The handle of the object.
+         *
+         * @throws std::length_error if every index is in use.
+         */
+        template <typename... Args>
+            requires std::constructible_from<S, Args...>
+        Handle emplace(Args&&... args)
+        {
+            auto index = pop_free();
+            if (index == no_index) {
+                index = m_end.fetch_add(1, std::memory_order_relaxed);
+                if (index >= max_index) {
+                    m_end.fetch_sub(1, std::memory_order_relaxed);
+                    throw std::length_error{ "SyncSlab is full" };
+                }
+                ensure_chunk(index);
+            }
+
+            auto& entry = *slot(index);
+            try {
+                std::construct_at(entry.object(), std::forward<Args>(args)...);
+            } catch (...) {
+                push_free(index);
+                throw;
+            }
+
+            auto generation = entry.m_generation.fetch_add(1, std::memory_order_release) + 1;    // odd: live
+            m_size.fetch_add(1, std::memory_order_relaxed);
+            return { static_cast<std::uint32_t>(index), generation };
+        }
+
+        /**
+         * @brief Destroy an object and recycle its slot.
+         *
+         * @return false if the handle is stale.
+         */
+        bool erase(Handle handle)
+        {
+            auto* slot = live_slot(handle);
+            if (slot == nullptr) {
+                return false;
+            }
+
+            // claim the object, a concurrent erase of the same handle fails here
+            auto generation = handle.m_generation;
+            if (not slot->m_generation.compare_exchange_strong(generation, generation + 1)) {
+                return false;
+            }
+
+            std::destroy_at(slot->object());
+            m_size.fetch_sub(1, std::memory_order_relaxed);
+            push_free(handle.m_index);
+            return true;
+        }
+
+        /**
+         * @brief Get the object of a handle.
+         *
+         * @return Pointer to the object, nullptr if the handle is stale.
+         */
+        S* find(Handle handle)
+        {
+            auto* slot = live_slot(handle);
+            return slot != nullptr ? slot->object() : nullptr;
+        }
+
+        const S* find(Handle handle) const
+        {
+            auto* slot = live_slot(handle);
+            return slot != nullptr ? slot->object() : nullptr;
+        }
+
+        /**
+         * @brief Get the object of a handle, which must be live.
+         */
+        S&       operator[](Handle handle) { return *slot(handle.m_index)->object(); }
+        const S& operator[](Handle handle) const { return *slot(handle.m_index)->object(); }
+
+        /**
+         * @brief Get the handle of an object of the slab.
+         */
+        Handle handle_of(const S& element) const
+        {
+            auto address = reinterpret_cast<std::uintptr_t>(&element);
+            for (auto k = 0u; k < max_chunks; ++k) {
+                auto chunk = reinterpret_cast<std::uintptr_t>(m_chunks[k].load(std::memory_order_acquire));
+                if (chunk != 0 and address >= chunk and address < chunk + chunk_size(k) * sizeof(Slot)) {
+                    auto index = chunk_start(k) + (address - chunk) / sizeof(Slot);
+                    auto gen   = slot(index)->m_generation.load(std::memory_order_acquire);
+                    return { static_cast<std::uint32_t>(index), gen };
+                }
+            }
+            throw std::out_of_range{ "The object is not in this SyncSlab" };
+        }
+
+        /**
+         * @brief The number of live objects.
+         */
+        std::size_t size() const noexcept { return m_size.load(std::memory_order_relaxed); }
+
+        bool empty() const noexcept { return size() == 0; }
+
+        auto begin() { return Iterator<false>{ this, 0, handed_out() }; }
+        auto end() { return Iterator<false>{ this, handed_out(), handed_out() }; }
+        auto begin() const { return Iterator<true>{ this, 0, handed_out() }; }
+        auto end() const { return Iterator<true>{ this, handed_out(), handed_out() }; }
+
+    private:
+        struct Slot
+        {
+            S* object() const
+            {
+                return std::launder(reinterpret_cast<S*>(const_cast<std::byte*>(m_storage)));
+            }
+
+            alignas(S) std::byte       m_storage[sizeof(S)];
+            std::atomic<std::uint32_t> m_generation = 0;    // odd while an object is live
+            std::atomic<std::uint32_t> m_next_free  = 0;
+        };
+
+        // chunk k holds ChunkSize << k slots, 32 of them cover every 32-bit index
+        static constexpr std::size_t max_chunks      = 32;
+        static constexpr std::size_t max_index       = std::numeric_limits<std::uint32_t>::max() - 1;
+        static constexpr std::size_t no_index        = std::numeric_limits<std::size_t>::max();
+        static constexpr std::size_t chunk_alignment = std::max(detail::cache_line_size, alignof(Slot));
+
+        static constexpr std::size_t chunk_size(std::size_t k) { return ChunkSize << k; }
+
+        static constexpr std::size_t chunk_start(std::size_t k)
+        {
+            return ChunkSize * ((std::size_t{ 1 } << k) - 1);
+        }
+
+        static constexpr std::size_t chunk_of(std::size_t index)
+        {
+            return static_cast<std::size_t>(std::bit_width(index / ChunkSize + 1)) - 1;
+        }
+
+        std::size_t handed_out() const
+        {
+            return std::min(m_end.load(std::memory_order_acquire), max_index);
+        }
+
+        // nullptr if the chunk of the index is not allocated yet
+        Slot* slot(std::size_t index) const
+        {
+            auto  k     = chunk_of(index);
+            auto* chunk = m_chunks[k].load(std::memory_order_acquire);
+            return chunk != nullptr ? chunk + (index - chunk_start(k)) : nullptr;
+        }
+
+        Slot* live_slot(Handle handle) const
+        {
+            if (handle.m_index >= handed_out() or handle.m_generation % 2 == 0) {
+                return nullptr;
+            }
+            auto* slot = this->slot(handle.m_index);
+            if (slot == nullptr) {
+                return nullptr;
+            }
+            return slot->m_generation.load(std::memory_order_acquire) == handle.m_generation ? slot : nullptr;
+        }
+
+        std::size_t next_live(std::size_t index, std::size_t end) const
+        {
+            for (; index < end; ++index) {
+                auto* slot = this->slot(index);
+                if (slot != nullptr and slot->m_generation.load(std::memory_order_acquire) % 2 == 1) {
+                    return index;
+                }
+            }
+            return end;
+        }
+
+        void ensure_chunk(std::size_t index)
+        {
+            auto k = chunk_of(index);
+            if (m_chunks[k].load(std::memory_order_acquire) != nullptr) {
+                return;
+            }
+
+            auto lock = std::lock_guard{ m_grow_mutex };
+            if (m_chunks[k].load(std::memory_order_relaxed) == nullptr) {
+                auto  bytes  = chunk_size(k) * sizeof(Slot);
+                auto* chunk  = static_cast<Slot*>(::operator new(bytes, std::align_val_t{ chunk_alignment }));
+                std::uninitialized_default_construct_n(chunk, chunk_size(k));
+                m_chunks[k].store(chunk, std::memory_order_release);
+            }
+        }
+
+        // the free list is a Treiber stack, its head packs a tag against ABA with the index + 1
+        static constexpr std::uint64_t pack(std::uint64_t tag, std::size_t index)
+        {
+            return tag << 32 | index;
+        }
+
+        std::size_t pop_free()
+        {
+            auto head = m_free.load(std::memory_order_acquire);
+            while (true) {
+                auto top = head & 0xFFFF'FFFF;
+                if (top == 0) {
+                    return no_index;
+                }
+                auto next    = slot(top - 1)->m_next_free.load(std::memory_order_relaxed);
+                auto desired = pack((head >> 32) + 1, next);
+                if (m_free.compare_exchange_weak(head, desired, std::memory_order_acquire)) {
+                    return top - 1;
+                }
+            }
+        }
+
+        void push_free(std::size_t index)
+        {
+            auto& entry = *slot(index);
+            auto  head  = m_free.load(std::memory_order_relaxed);
+            do {
+                auto next = static_cast<std::uint32_t>(head & 0xFFFF'FFFF);
+                entry.m_next_free.store(next, std::memory_order_relaxed);
+            } while (not m_free.compare_exchange_weak(
+                head, pack((head >> 32) + 1, index + 1), std::memory_order_release, std::memory_order_relaxed
+            ));
+        }
+
+        std::array<std::atomic<Slot*>, max_chunks> m_chunks = {};
+        std::atomic<std::size_t>                   m_end    = 0;    // indices below it have been handed out
+        std::atomic<std::size_t>                   m_size   = 0;
+        std::atomic<std::uint64_t>                 m_free   = 0;
+        std::mutex                                 m_grow_mutex;
+    };
+}
+
+#endif /* end of include guard: SYNC_CPP_SYNC_SLAB_HPP_4VQN7EJX */
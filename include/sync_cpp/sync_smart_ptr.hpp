@@ -45,14 +45,16 @@ namespace spp
         concepts::SmartPointer SP,
         concepts::SyncMutex    Mtx           = std::mutex,
         bool                   CheckedAccess = true,
-        bool                   InternalMutex = true>
+        bool                   InternalMutex = true,
+        SyncLayout             Layout        = SyncLayout::Compact>
         requires concepts::Syncable<typename SP::element_type>
     class SyncSmartPtr : public SyncContainer<
                              SP,
                              typename SP::element_type,
                              SyncSmartPtrAccessor<CheckedAccess>,
                              Mtx,
-                             InternalMutex>
+                             InternalMutex,
+                             Layout>
     {
     public:
         using SyncBase = SyncContainer<
@@ -60,7 +62,8 @@ namespace spp
             typename SP::element_type,
             SyncSmartPtrAccessor<CheckedAccess>,
             Mtx,
-            InternalMutex>;
+            InternalMutex,
+            Layout>;
 
         using Value   = typename SyncBase::Value;
         using Mutex   = typename SyncBase::Mutex;
@@ -132,8 +135,13 @@ namespace spp
      *
      * @tparam T The type of the unique pointer element.
      */
-    template <typename T, typename Mtx = std::mutex, bool CheckedAccess = true, bool InternalMutex = true>
-    using SyncUnique = SyncSmartPtr<std::unique_ptr<T>, Mtx, CheckedAccess, InternalMutex>;
+    template <
+        typename T,
+        typename Mtx       = std::mutex,
+        bool CheckedAccess = true,
+        bool InternalMutex = true,
+        SyncLayout Layout  = SyncLayout::Compact>
+    using SyncUnique = SyncSmartPtr<std::unique_ptr<T>, Mtx, CheckedAccess, InternalMutex, Layout>;
 
     /**
      * @brief A wrapper around a unique pointer with a custom deleter and a mutex.
@@ -146,16 +154,23 @@ namespace spp
         typename Delete,
         typename Mtx       = std::mutex,
         bool CheckedAccess = true,
-        bool InternalMutex = true>
-    using SyncUniqueCustom = SyncSmartPtr<std::unique_ptr<T, Delete>, Mtx, CheckedAccess, InternalMutex>;
+        bool InternalMutex = true,
+        SyncLayout Layout  = SyncLayout::Compact>
+    using SyncUniqueCustom
+        = SyncSmartPtr<std::unique_ptr<T, Delete>, Mtx, CheckedAccess, InternalMutex, Layout>;
 
     /**
      * @brief A wrapper around a shared pointer with a mutex.
      *
      * @tparam T The type of the shared pointer element.
      */
-    template <typename T, typename Mtx = std::mutex, bool CheckedAccess = true, bool InternalMutex = true>
-    using SyncShared = SyncSmartPtr<std::shared_ptr<T>, Mtx, CheckedAccess, InternalMutex>;
+    template <
+        typename T,
+        typename Mtx       = std::mutex,
+        bool CheckedAccess = true,
+        bool InternalMutex = true,
+        SyncLayout Layout  = SyncLayout::Compact>
+    using SyncShared = SyncSmartPtr<std::shared_ptr<T>, Mtx, CheckedAccess, InternalMutex, Layout>;
     // -------
 
     // deduction guides
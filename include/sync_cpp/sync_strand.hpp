@@ -0,0 +1,240 @@
+#ifndef SYNC_CPP_SYNC_STRAND_HPP_7KD2WQ9E
+#define SYNC_CPP_SYNC_STRAND_HPP_7KD2WQ9E
+
+#include "sync_cpp/concepts.hpp"
+#include "sync_cpp/thread_pool.hpp"
+
+#include <concepts>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+namespace spp
+{
+    namespace detail
+    {
+        // a callback taking the result of an operation, or nothing if it returns void
+        template <typename Done, typename Ret>
+        concept Completion = (std::is_void_v<Ret> and std::invocable<std::decay_t<Done>&>)
+                          or std::invocable<std::decay_t<Done>&, Ret>;
+    }
+
+    /**
+     * @class SyncStrand
+     *
+     * @brief A wrapper around a class object whose operations are queued and run one at a time on a thread
+     * pool, instead of blocking the callers.
+     *
+     * The operations run in the order they were queued, never two at once, so the value is touched by one
+     * worker at a time and stays in its cache for a whole batch of them. A caller gets the result through a
+     * future, or has a completion callback called with it on the worker.
+     *
+     * The functions run on the pool: they must not rely on thread-local state, and must not wait for another
+     * operation of the same strand (that one runs after them). The destructor waits for the queued
+     * operations.
+     *
+     * @tparam T The type of the object to wrap.
+     */
+    template <concepts::Syncable T>
+    class SyncStrand
+    {
+    public:
+        using Value = T;
+
+        SyncStrand(const SyncStrand&)            = delete;
+        SyncStrand& operator=(const SyncStrand&) = delete;
+        SyncStrand(SyncStrand&&)                 = delete;
+        SyncStrand& operator=(SyncStrand&&)      = delete;
+
+        // prevent class from being created using new and destructed using delete
+        static void* operator new(size_t)     = delete;
+        static void* operator new[](size_t)   = delete;
+        static void  operator delete(void*)   = delete;
+        static void  operator delete[](void*) = delete;
+
+        /**
+         * @param pool The pool the operations run on, must outlive the strand.
+         * @param args The arguments to construct the value with.
+         */
+        template <typename... Args>
+            requires std::constructible_from<T, Args...>
+        SyncStrand(ThreadPool& pool, Args&&... args)
+            : m_pool{ pool }
+            , m_value{ std::forward<Args>(args)... }
+        {
+        }
+
+        /**
+         * @brief Construct the value, the operations run on the global pool.
+         */
+        template <typename... Args>
+            requires std::constructible_from<T, Args...>
+        SyncStrand(Args&&... args)
+            : SyncStrand{ ThreadPool::global(), std::forward<Args>(args)... }
+        {
+        }
+
+        ~SyncStrand() { wait(); }
+
+        /**
+         * @brief Queue a read-only access to the wrapped value.
+         *
+         * @param fn The function to call with the value.
+         *
+         * @return A future for the return value (or the exception) of the function.
+         */
+        template <std::invocable<const T&> Fn>
+        [[nodiscard]] auto read_async(Fn&& fn) -> std::future<std::invoke_result_t<Fn&, const T&>>
+        {
+            return queue_future<const T&>(std::forward<Fn>(fn));
+        }
+
+        /**
+         * @brief Queue a read-only access to the wrapped value, with a completion callback.
+         *
+         * @param fn The function to call with the value.
+         * @param on_done Called on the worker with the return value of the function (with nothing if it
+         * returns void). Neither may throw.
+         */
+        template <std::invocable<const T&> Fn, typename Done>
+            requires detail::Completion<Done, std::invoke_result_t<Fn&, const T&>>
+        void read_async(Fn&& fn, Done&& on_done)
+        {
+            queue_callback<const T&>(std::forward<Fn>(fn), std::forward<Done>(on_done));
+        }
+
+        /**
+         * @brief Queue a read-write access to the wrapped value.
+         *
+         * @param fn The function to call with the value.
+         *
+         * @return A future for the return value (or the exception) of the function.
+         */
+        template <std::invocable<T&> Fn>
+        [[nodiscard]] auto write_async(Fn&& fn) -> std::future<std::invoke_result_t<Fn&, T&>>
+        {
+            return queue_future<T&>(std::forward<Fn>(fn));
+        }
+
+        /**
+         * @brief Queue a read-write access to the wrapped value, with a completion callback.
+         *
+         * @param fn The function to call with the value.
+         * @param on_done Called on the worker with the return value of the function (with nothing if it
+         * returns void). Neither may throw.
+         */
+        template <std::invocable<T&> Fn, typename Done>
+            requires detail::Completion<Done, std::invoke_result_t<Fn&, T&>>
+        void write_async(Fn&& fn, Done&& on_done)
+        {
+            queue_callback<T&>(std::forward<Fn>(fn), std::forward<Done>(on_done));
+        }
+
+        /**
+         * @brief Block until every operation queued so far has run.
+         *
+         * Must not be called from an operation of this strand.
+         */
+        void wait()
+        {
+            auto lock = std::unique_lock{ m_mutex };
+            m_idle.wait(lock, [&] { return not m_scheduled; });
+        }
+
+    private:
+        // operations run in one turn on a worker before the strand yields it to other tasks
+        static constexpr int batch_limit = 64;
+
+        template <typename Arg, typename Fn, typename Ret = std::invoke_result_t<Fn&, Arg>>
+        std::future<Ret> queue_future(Fn&& fn)
+        {
+            static_assert(
+                not std::is_lvalue_reference_v<Ret>,
+                "Function returning a reference in multithreaded context is dangerous! Consider copying "
+                "instead."
+            );
+
+            auto promise = std::promise<Ret>{};
+            auto future  = promise.get_future();
+
+            enqueue([this, fn = std::forward<Fn>(fn), promise = std::move(promise)]() mutable {
+                try {
+                    if constexpr (std::is_void_v<Ret>) {
+                        std::invoke(fn, static_cast<Arg>(m_value));
+                        promise.set_value();
+                    } else {
+                        promise.set_value(std::invoke(fn, static_cast<Arg>(m_value)));
+                    }
+                } catch (...) {
+                    promise.set_exception(std::current_exception());
+                }
+            });
+
+            return future;
+        }
+
+        template <typename Arg, typename Fn, typename Done, typename Ret = std::invoke_result_t<Fn&, Arg>>
+        void queue_callback(Fn&& fn, Done&& on_done)
+        {
+            static_assert(
+                not std::is_lvalue_reference_v<Ret>,
+                "Function returning a reference in multithreaded context is dangerous! Consider copying "
+                "instead."
+            );
+
+            enqueue([this, fn = std::forward<Fn>(fn), on_done = std::forward<Done>(on_done)]() mutable {
+                if constexpr (std::is_void_v<Ret>) {
+                    std::invoke(fn, static_cast<Arg>(m_value));
+                    std::invoke(on_done);
+                } else {
+                    std::invoke(on_done, std::invoke(fn, static_cast<Arg>(m_value)));
+                }
+            });
+        }
+
+        void enqueue(detail::Task task)
+        {
+            auto lock = std::unique_lock{ m_mutex };
+            m_queue.push_back(std::move(task));
+            if (std::exchange(m_scheduled, true)) {
+                return;    // the running batch picks it up
+            }
+            lock.unlock();
+            m_pool.post([this] { drain(); });
+        }
+
+        void drain()
+        {
+            for (auto i = 0; i < batch_limit; ++i) {
+                auto lock = std::unique_lock{ m_mutex };
+                if (m_queue.empty()) {
+                    m_scheduled = false;
+                    m_idle.notify_all();
+                    return;
+                }
+                auto task = std::move(m_queue.front());
+                m_queue.pop_front();
+                lock.unlock();
+
+                task();
+            }
+
+            // still scheduled, continue after the other tasks of the pool (post() would run it next)
+            m_pool.post_fair([this] { drain(); });
+        }
+
+        ThreadPool&              m_pool;
+        std::mutex               m_mutex;
+        std::condition_variable  m_idle;
+        std::deque<detail::Task> m_queue;
+        bool                     m_scheduled = false;    // a drain is queued or running
+        T                        m_value;
+    };
+}
+
+#endif /* end of include guard: SYNC_CPP_SYNC_STRAND_HPP_7KD2WQ9E */
@@ -0,0 +1,188 @@
+#ifndef SYNC_CPP_THREAD_POOL_HPP_G1NZ8C4U
+#define SYNC_CPP_THREAD_POOL_HPP_G1NZ8C4U
+
+#include "sync_cpp/detail/hardware.hpp"
+#include "sync_cpp/detail/task.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace spp
+{
+    /**
+     * @class ThreadPool
+     *
+     * @brief A fixed-size work-stealing thread pool.
+     *
+     * Every worker has its own queue: a task posted from a worker goes to the back of that worker's queue and
+     * the worker runs its own queue newest first (the data it just touched is still in its cache), tasks
+     * posted from other threads are spread over the queues round-robin. An idle worker steals the oldest task
+     * of another queue, and parks when there is none. Tasks must not throw (like the function of a thread).
+     */
+    class ThreadPool
+    {
+    public:
+        /**
+         * @param threads The number of worker threads, at least 1.
+         */
+        explicit ThreadPool(std::size_t threads = std::max(std::thread::hardware_concurrency(), 1u))
+        {
+            threads = std::max(threads, std::size_t{ 1 });
+            for (auto i = 0u; i < threads; ++i) {
+                m_queues.push_back(std::make_unique<Queue>());
+            }
+            for (auto i = 0u; i < threads; ++i) {
+                m_threads.emplace_back([this, i] { run(i); });
+            }
+        }
+
+        ThreadPool(const ThreadPool&)            = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /**
+         * @brief Run the tasks still queued, then stop the workers.
+         */
+        ~ThreadPool()
+        {
+            m_stopping.store(true, std::memory_order_relaxed);
+            wake(true);
+            m_threads.clear();
+        }
+
+        /**
+         * @brief The process-wide pool, one worker per hardware thread, created on first use.
+         */
+        static ThreadPool& global()
+        {
+            static auto s_pool = ThreadPool{};
+            return s_pool;
+        }
+
+        std::size_t size() const noexcept { return m_queues.size(); }
+
+        /**
+         * @brief Queue a task to run on one of the workers.
+         */
+        void post(detail::Task task) { push(std::move(task), false); }
+
+        /**
+         * @brief Queue a task to run after the tasks already queued: it's the oldest task of its queue, taken
+         * last by its own worker and first by the others.
+         *
+         * For a task that yields its worker and continues later, post() would run it again right away.
+         */
+        void post_fair(detail::Task task) { push(std::move(task), true); }
+
+    private:
+        struct alignas(detail::cache_line_size) Queue
+        {
+            std::mutex               m_mutex;
+            std::deque<detail::Task> m_tasks;
+        };
+
+        // the pool and index of the calling thread, if it's a worker
+        struct WorkerId
+        {
+            const ThreadPool* m_pool  = nullptr;
+            std::size_t       m_index = 0;
+        };
+
+        static WorkerId& current_worker()
+        {
+            thread_local auto t_worker = WorkerId{};
+            return t_worker;
+        }
+
+        void push(detail::Task task, bool oldest)
+        {
+            auto worker = current_worker();
+            auto index  = worker.m_pool == this ? worker.m_index
+                                                : m_next.fetch_add(1, std::memory_order_relaxed) % size();
+
+            auto& queue = *m_queues[index];
+            {
+                auto lock = std::lock_guard{ queue.m_mutex };
+                oldest ? queue.m_tasks.push_front(std::move(task)) : queue.m_tasks.push_back(std::move(task));
+            }
+            wake(false);
+        }
+
+        void wake(bool all)
+        {
+            m_epoch.fetch_add(1, std::memory_order_seq_cst);
+            if (m_sleeping.load(std::memory_order_seq_cst) > 0) {
+                all ? m_epoch.notify_all() : m_epoch.notify_one();
+            }
+        }
+
+        // own queue newest first, then steal the oldest task of the others
+        std::optional<detail::Task> find(std::size_t index)
+        {
+            {
+                auto& own  = *m_queues[index];
+                auto  lock = std::lock_guard{ own.m_mutex };
+                if (not own.m_tasks.empty()) {
+                    auto task = std::move(own.m_tasks.back());
+                    own.m_tasks.pop_back();
+                    return task;
+                }
+            }
+
+            for (auto i = 1u; i < size(); ++i) {
+                auto& other = *m_queues[(index + i) % size()];
+                auto  lock  = std::lock_guard{ other.m_mutex };
+                if (not other.m_tasks.empty()) {
+                    auto task = std::move(other.m_tasks.front());
+                    other.m_tasks.pop_front();
+                    return task;
+                }
+            }
+            return std::nullopt;
+        }
+
+        void run(std::size_t index)
+        {
+            current_worker() = { this, index };
+            while (true) {
+                if (auto task = find(index)) {
+                    (*task)();
+                    continue;
+                }
+
+                // a task posted after this load changes the epoch, so the wait below won't sleep through it
+                auto epoch = m_epoch.load(std::memory_order_seq_cst);
+                if (auto task = find(index)) {
+                    (*task)();
+                    continue;
+                }
+                if (m_stopping.load(std::memory_order_relaxed)) {
+                    return;
+                }
+
+                m_sleeping.fetch_add(1, std::memory_order_seq_cst);
+                m_epoch.wait(epoch, std::memory_order_seq_cst);
+                m_sleeping.fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+
+        std::vector<std::unique_ptr<Queue>> m_queues;
+        std::atomic<std::size_t>            m_next     = 0;
+        std::atomic<std::uint32_t>          m_epoch    = 0;
+        std::atomic<std::uint32_t>          m_sleeping = 0;
+        std::atomic<bool>                   m_stopping = false;
+        std::vector<std::jthread>           m_threads;    // last, the workers use everything above
+    };
+}
+
+#endif /* end of include guard: SYNC_CPP_THREAD_POOL_HPP_G1NZ8C4U */
@@ -0,0 +1,132 @@
+#ifndef SYNC_CPP_TRACE_HPP_D8KM4WQE
+#define SYNC_CPP_TRACE_HPP_D8KM4WQE
+
+#include "sync_cpp/detail/trace.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/**
+ * Lock tracing, compiled in only when SYNC_CPP_TRACE is defined (the same way in every translation unit).
+ *
+ * Sync::get/read/write, SyncContainer::get_value/read_value/write_value and Group::read/write/lock then
+ * record when they start waiting for their lock, acquire it and release it, together with their call site,
+ * into a ring buffer of the calling thread (SYNC_CPP_TRACE_BUFFER_SIZE events each). Without SYNC_CPP_TRACE
+ * nothing is recorded and there is no cost at all.
+ */
+namespace spp::trace
+{
+    inline constexpr bool enabled = detail::trace_enabled;
+
+    using Phase = detail::TracePhase;
+    using Event = detail::TraceEvent;
+
+    /**
+     * @class ThreadEvents
+     *
+     * @brief The recorded events of one thread, oldest first.
+     */
+    struct ThreadEvents
+    {
+        std::size_t        m_thread;
+        std::vector<Event> m_events;
+    };
+
+    /**
+     * @brief Copy the events recorded so far, threads may keep recording meanwhile.
+     */
+    inline std::vector<ThreadEvents> snapshot()
+    {
+        auto threads = std::vector<ThreadEvents>{};
+#if defined(SYNC_CPP_TRACE)
+        detail::TraceRegistry::instance().for_each([&](const detail::TraceBuffer& buffer) {
+            threads.push_back({ buffer.thread(), buffer.events() });
+        });
+#endif
+        return threads;
+    }
+
+    /**
+     * @brief Drop every recorded event.
+     */
+    inline void clear()
+    {
+#if defined(SYNC_CPP_TRACE)
+        auto& registry = detail::TraceRegistry::instance();
+        registry.prune();
+        registry.for_each([](detail::TraceBuffer& buffer) { buffer.clear(); });
+#endif
+    }
+
+    /**
+     * @brief Write the recorded events in the Chrome trace event format (chrome://tracing, Perfetto).
+     *
+     * Every thread is a track, the wait for and the hold of each lock are slices named after the call site.
+     * A slice whose begin or end was overwritten in the ring buffer is left unopened or unclosed.
+     *
+     * @param out The stream to write the JSON document to.
+     */
+    inline void write_chrome_json(std::ostream& out)
+    {
+        auto escaped = [&](std::string_view value) {
+            for (auto c : value) {
+                if (c == '"' or c == '\\') {
+                    out << '\\' << c;
+                } else {
+                    out << (static_cast<unsigned char>(c) < 0x20 ? ' ' : c);
+                }
+            }
+        };
+
+        // microseconds with nanosecond precision
+        auto header = [&](char phase, std::size_t thread, std::uint64_t time) {
+            auto fraction = time % 1000;
+            out << "{\"ph\":\"" << phase << "\",\"pid\":1,\"tid\":" << thread << ",\"ts\":" << time / 1000
+                << '.' << fraction / 100 << fraction / 10 % 10 << fraction % 10;
+        };
+
+        auto begin = [&](std::string_view slice, std::size_t thread, const Event& event) {
+            auto file = std::string_view{ event.m_file };
+            file      = file.substr(file.find_last_of("/\\") + 1);
+
+            header('B', thread, event.m_time);
+            out << ",\"cat\":\"sync_cpp\",\"name\":\"" << slice;
+            if (not file.empty()) {
+                out << ' ';
+                escaped(file);
+                out << ':' << event.m_line;
+            }
+            out << "\",\"args\":{\"mutex\":\"" << event.m_mutex << "\",\"mode\":\""
+                << (event.m_shared ? "shared" : "exclusive") << "\",\"count\":" << event.m_count
+                << ",\"function\":\"";
+            escaped(event.m_function);
+            out << "\"}}";
+        };
+
+        auto end = [&](std::size_t thread, const Event& event) {
+            header('E', thread, event.m_time);
+            out << '}';
+        };
+
+        auto separator = "\n";
+        auto next      = [&] { out << std::exchange(separator, ",\n"); };
+
+        out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+        for (const auto& [thread, events] : snapshot()) {
+            for (const auto& event : events) {
+                switch (event.m_phase) {
+                case Phase::Wait: next(), begin("wait", thread, event); break;
+                case Phase::Acquire: next(), end(thread, event), next(), begin("hold", thread, event); break;
+                case Phase::Release: next(), end(thread, event); break;
+                }
+            }
+        }
+        out << "\n]}\n";
+    }
+}
+
+#endif /* end of include guard: SYNC_CPP_TRACE_HPP_D8KM4WQE */
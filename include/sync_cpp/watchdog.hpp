@@ -0,0 +1,240 @@
+#ifndef SYNC_CPP_WATCHDOG_HPP_J4ZP7FNC
+#define SYNC_CPP_WATCHDOG_HPP_J4ZP7FNC
+
+#include "sync_cpp/concepts.hpp"
+#include "sync_cpp/detail/trace.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <stop_token>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * Long-hold watchdog, compiled in only when SYNC_CPP_WATCHDOG is defined (the same way in every translation
+ * unit).
+ *
+ * Sync::get/read/write, SyncContainer::get_value/read_value/write_value and Group::read/write/lock then
+ * publish the locks they hold, with the call site and the time of the acquisition, in a table of the
+ * calling thread that a Watchdog scans. Without SYNC_CPP_WATCHDOG nothing is published and a Watchdog sees
+ * no holds.
+ */
+namespace spp
+{
+    /**
+     * @class LongHold
+     *
+     * @brief A lock held past its budget, as reported by a Watchdog.
+     */
+    struct LongHold
+    {
+        std::size_t              m_thread;       // the library's thread index (same as in a trace)
+        std::thread::id          m_thread_id;    // the holding thread
+        const void*              m_mutex;        // the (first) mutex held
+        const char*              m_file;         // empty if the call site is unknown
+        const char*              m_function;     // empty if the call site is unknown
+        std::uint32_t            m_line;         // the line of the call site
+        bool                     m_shared;       // held in shared mode
+        std::chrono::nanoseconds m_held;         // how long the lock had been held when detected
+        std::chrono::nanoseconds m_budget;       // the budget it exceeded
+    };
+
+    /**
+     * @class Watchdog
+     *
+     * @brief Detects critical sections that exceed a hold-time budget, from a background thread.
+     *
+     * Every scan reads the locks currently held by every thread; a lock held past its budget is reported
+     * once, while it is still held, and the holder keeps running. The budget is global with per-object
+     * overrides, an object is identified by its mutex (objects sharing a mutex share their budget).
+     */
+    class Watchdog
+    {
+    public:
+        using Handler = std::function<void(const LongHold&)>;
+
+        static constexpr bool enabled = detail::watchdog_enabled;
+
+        /**
+         * @brief Print the long hold to stderr.
+         */
+        static void print(const LongHold& hold)
+        {
+            auto held   = std::chrono::duration<double, std::milli>{ hold.m_held };
+            auto budget = std::chrono::duration<double, std::milli>{ hold.m_budget };
+
+            auto out = std::ostringstream{};
+            out << "sync_cpp watchdog: thread " << hold.m_thread << " (" << hold.m_thread_id << ") held the "
+                << (hold.m_shared ? "shared" : "exclusive") << " lock of " << hold.m_mutex << " for "
+                << held.count() << "ms (budget " << budget.count() << "ms)";
+            if (*hold.m_file != '\0') {
+                out << " at " << hold.m_file << ':' << hold.m_line << " in " << hold.m_function;
+            }
+            out << '\n';
+            std::cerr << std::move(out).str() << std::flush;
+        }
+
+        /**
+         * @brief Print the long hold to stderr, then abort (e.g. to fail a test run in CI).
+         */
+        [[noreturn]] static void fatal(const LongHold& hold)
+        {
+            print(hold);
+            std::abort();
+        }
+
+        /**
+         * @param budget The hold-time budget of every object without a budget of its own.
+         * @param handler The action to take on every long hold, called on the watchdog thread.
+         * @param interval The time between two scans, a quarter of the budget (at least 1ms) by default.
+         */
+        explicit Watchdog(
+            std::chrono::nanoseconds budget,
+            Handler                  handler  = print,
+            std::chrono::nanoseconds interval = {}
+        )
+            : m_budget{ budget }
+            , m_handler{ std::move(handler) }
+            , m_thread{ [this, interval = default_interval(budget, interval)](std::stop_token token) {
+                run(token, interval);
+            } }
+        {
+        }
+
+        Watchdog(const Watchdog&)            = delete;
+        Watchdog& operator=(const Watchdog&) = delete;
+
+        /**
+         * @brief Set the hold-time budget of an object.
+         */
+        template <concepts::SyncDerivative S>
+        void set_budget(const S& sync, std::chrono::nanoseconds budget)
+        {
+            auto lock = std::lock_guard{ m_mutex };
+            auto it   = std::ranges::find(m_budgets, &sync.mutex(), &Budget::m_mutex);
+            if (it == m_budgets.end()) {
+                m_budgets.push_back({ &sync.mutex(), budget });
+            } else {
+                it->m_budget = budget;
+            }
+        }
+
+        /**
+         * @brief Make an object use the global budget again.
+         */
+        template <concepts::SyncDerivative S>
+        void reset_budget(const S& sync)
+        {
+            auto lock = std::lock_guard{ m_mutex };
+            std::erase_if(m_budgets, [&](const Budget& budget) { return budget.m_mutex == &sync.mutex(); });
+        }
+
+        /**
+         * @brief Scan the held locks now, in addition to the periodic scans.
+         */
+        void scan()
+        {
+            auto long_holds = std::vector<LongHold>{};
+            {
+                auto lock       = std::lock_guard{ m_mutex };
+                auto still_held = std::vector<HoldId>{};
+
+#if defined(SYNC_CPP_WATCHDOG)
+                auto  now      = std::chrono::steady_clock::now();
+                auto& registry = detail::HoldRegistry::instance();
+                registry.prune();
+                registry.for_each([&](const detail::HoldTable& table) {
+                    table.for_each([&](const detail::HoldTable::Hold& hold) {
+                        auto held   = std::chrono::nanoseconds{ now - hold.m_start };
+                        auto budget = budget_of(hold.m_mutex);
+                        if (held <= budget) {
+                            return;
+                        }
+
+                        auto id = HoldId{ table.thread(), hold.m_id };
+                        still_held.push_back(id);
+                        if (std::ranges::find(m_reported, id) != m_reported.end()) {
+                            return;
+                        }
+                        long_holds.push_back({
+                            .m_thread    = table.thread(),
+                            .m_thread_id = table.thread_id(),
+                            .m_mutex     = hold.m_mutex,
+                            .m_file      = hold.m_file,
+                            .m_function  = hold.m_function,
+                            .m_line      = hold.m_line,
+                            .m_shared    = hold.m_shared,
+                            .m_held      = held,
+                            .m_budget    = budget,
+                        });
+                    });
+                });
+#endif
+
+                // only the holds that are still held need to be remembered
+                m_reported = std::move(still_held);
+            }
+
+            for (const auto& hold : long_holds) {
+                m_handler(hold);
+            }
+        }
+
+    private:
+        using HoldId = std::pair<std::size_t, std::uint64_t>;    // thread index, hold id
+
+        struct Budget
+        {
+            const void*              m_mutex;
+            std::chrono::nanoseconds m_budget;
+        };
+
+        static std::chrono::nanoseconds default_interval(
+            std::chrono::nanoseconds budget,
+            std::chrono::nanoseconds interval
+        )
+        {
+            if (interval > std::chrono::nanoseconds::zero()) {
+                return interval;
+            }
+            return std::max<std::chrono::nanoseconds>(budget / 4, std::chrono::milliseconds{ 1 });
+        }
+
+        std::chrono::nanoseconds budget_of(const void* mutex) const
+        {
+            auto it = std::ranges::find(m_budgets, mutex, &Budget::m_mutex);
+            return it == m_budgets.end() ? m_budget : it->m_budget;
+        }
+
+        void run(std::stop_token token, std::chrono::nanoseconds interval)
+        {
+            auto mutex = std::mutex{};
+            auto wake  = std::condition_variable_any{};
+            auto lock  = std::unique_lock{ mutex };
+            while (not token.stop_requested()) {
+                wake.wait_for(lock, token, interval, [] { return false; });
+                if (not token.stop_requested()) {
+                    scan();
+                }
+            }
+        }
+
+        std::mutex               m_mutex;    // protects the budgets and the reported holds
+        std::chrono::nanoseconds m_budget;
+        std::vector<Budget>      m_budgets;
+        std::vector<HoldId>      m_reported;
+        Handler                  m_handler;
+        std::jthread             m_thread;
+    };
+}
+
+#endif /* end of include guard: SYNC_CPP_WATCHDOG_HPP_J4ZP7FNC */
@@ -0,0 +1,154 @@
+#include <sync_cpp/sync.hpp>
+#include <sync_cpp/dynamic_group.hpp>
+#include <sync_cpp/lock_policy.hpp>
+
+#include <boost/ut.hpp>
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <numeric>
+#include <shared_mutex>
+#include <span>
+#include <thread>
+#include <utility>
+#include <vector>
+
+struct Shard
+{
+    long m_value = 0;
+};
+
+using Shards = std::vector<spp::Sync<Shard, std::shared_mutex>>;
+
+long sum(std::span<const std::reference_wrapper<const Shard>> shards)
+{
+    return std::accumulate(shards.begin(), shards.end(), 0l, [](long acc, const Shard& s) {
+        return acc + s.m_value;
+    });
+}
+
+int main()
+{
+    namespace ut = boost::ut;
+    using namespace ut::literals;
+
+    "A range of objects is locked at once"_test = [] {
+        auto shards = Shards(8);
+
+        spp::group(shards).write([](auto values) {
+            for (auto i = std::size_t{ 0 }; i < values.size(); ++i) {
+                values[i].get().m_value = static_cast<long>(i);
+            }
+        });
+        ut::expect(spp::group(shards).read(sum) == 28);
+
+        auto some = std::span{ shards }.subspan(2, 3);
+        ut::expect(spp::group(some).size() == 3);
+        ut::expect(spp::group(some).read(sum) == 9);
+
+        ut::expect(spp::group(std::span<spp::Sync<Shard, std::shared_mutex>>{}).read(sum) == 0);
+    };
+
+    "A subset is given by pointers, in any order and with duplicates"_test = [] {
+        auto shards = Shards(4);
+        auto batch  = std::vector{ &shards[3], &shards[0], &shards[3] };
+
+        spp::group(batch).write([](auto values) {
+            ut::expect(values.size() == 3);
+            for (Shard& shard : values) {
+                ++shard.m_value;
+            }
+        });
+        ut::expect(shards[3].read([](const Shard& s) { return s.m_value; }) == 2);
+        ut::expect(shards[0].read([](const Shard& s) { return s.m_value; }) == 1);
+        ut::expect(shards[1].read([](const Shard& s) { return s.m_value; }) == 0);
+    };
+
+    "A group is kept and reused"_test = [] {
+        auto shards = Shards(4);
+        auto batch  = spp::group(std::vector{ &shards[1], &shards[2], &shards[1] });
+
+        for (auto i = 0; i < 3; ++i) {
+            batch.write([](auto values) {
+                for (Shard& shard : values) {
+                    ++shard.m_value;
+                }
+            });
+        }
+        ut::expect(batch.read(sum) == 6 + 3 + 6);    // the duplicate twice
+        ut::expect(batch.try_write([](auto values) { values[1].get().m_value = 0; }));
+        ut::expect(spp::group(shards).read(sum) == 6);
+    };
+
+    "A range of const objects is read-only"_test = [] {
+        const auto shards = Shards(2);
+        auto       group  = spp::group(shards);
+
+        auto writer    = [](auto) {};
+        auto can_write = []<typename G, typename Fn>(const G&, const Fn&) {
+            return requires (const G& g, Fn fn) { g.write(fn); };
+        };
+        ut::expect(not can_write(group, writer));
+        auto mutable_shards = Shards(1);
+        ut::expect(can_write(spp::group(mutable_shards), writer));
+        ut::expect(group.try_read(sum) == 0l);
+    };
+
+    "All or nothing"_test = [] {
+        auto shards = Shards(3);
+
+        shards[1].write([&](Shard&) {
+            ut::expect(not spp::group(shards).try_write([](auto) {}));
+            ut::expect(not spp::group(shards).try_read(sum));
+            ut::expect(shards[0].try_write([](Shard&) {}));
+        });
+        ut::expect(spp::group(shards).try_write([](auto) {}));
+    };
+
+    "Batches in opposite orders don't deadlock"_test = [] {
+        constexpr auto threads    = 4;
+        constexpr auto iterations = 10'000;
+
+        auto shards   = Shards(16);
+        auto forward  = std::vector<spp::Sync<Shard, std::shared_mutex>*>{};
+        auto backward = std::vector<spp::Sync<Shard, std::shared_mutex>*>{};
+        for (auto& shard : shards) {
+            forward.push_back(&shard);
+            backward.insert(backward.begin(), &shard);
+        }
+
+        auto increment = [](auto values) {
+            for (Shard& shard : values) {
+                ++shard.m_value;
+            }
+        };
+        {
+            auto workers = std::vector<std::jthread>{};
+            for (auto t = 0; t < threads; ++t) {
+                workers.emplace_back([&, t] {
+                    for (auto i = 0; i < iterations; ++i) {
+                        if (t % 2 == 0) {
+                            spp::group(forward).write(increment);
+                        } else {
+                            spp::group<spp::lock_policy::Park>(backward).write(increment);
+                        }
+                    }
+                });
+            }
+        }
+
+        ut::expect(spp::group(shards).read(sum) == 16l * threads * iterations);
+    };
+
+    "Objects sharing an external mutex lock it once"_test = [] {
+        auto mutex  = std::mutex{};
+        auto shards = std::deque<spp::Sync<Shard, std::mutex, false>>{};
+        shards.emplace_back(mutex);
+        shards.emplace_back(mutex);
+
+        auto count = spp::group(shards).write([](auto values) { return values.size(); });
+        ut::expect(count == 2);
+    };
+}
@@ -0,0 +1,203 @@
+#include <sync_cpp/sync.hpp>
+#include <sync_cpp/group.hpp>
+#include <sync_cpp/lock_policy.hpp>
+
+#include <boost/ut.hpp>
+
+#include <chrono>
+#include <latch>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+struct Counter
+{
+    long m_value = 0;
+};
+
+// a recursive mutex that counts its lock operations
+class CountingMutex
+{
+public:
+    void lock() { m_mutex.lock(), ++m_locks; }
+    bool try_lock() { return m_mutex.try_lock() and (++m_locks, true); }
+    void unlock() { m_mutex.unlock(); }
+
+    int locks() const { return m_locks; }
+
+private:
+    std::recursive_mutex m_mutex;
+    int                  m_locks = 0;
+};
+
+// groups of the same objects in opposite orders, from several threads
+template <typename Policy>
+void race_opposite_orders()
+{
+    namespace ut = boost::ut;
+
+    constexpr auto threads    = 4;
+    constexpr auto iterations = 20'000;
+
+    auto a  = spp::Sync<Counter, std::shared_mutex>{};
+    auto b  = spp::Sync<Counter>{};
+    auto& c = std::as_const(a);
+    {
+        auto workers = std::vector<std::jthread>{};
+        for (auto t = 0; t < threads; ++t) {
+            workers.emplace_back([&, t] {
+                for (auto i = 0; i < iterations; ++i) {
+                    if (t % 2 == 0) {
+                        spp::group<Policy>(a, b).write([](Counter& x, Counter& y) {
+                            ++x.m_value, ++y.m_value;
+                        });
+                    } else {
+                        spp::group<Policy>(b, c).lock([](Counter& y, const Counter&) { ++y.m_value; });
+                    }
+                }
+            });
+        }
+    }
+
+    ut::expect(a.read([](const Counter& x) { return x.m_value; }) == threads / 2 * iterations);
+    ut::expect(b.read([](const Counter& y) { return y.m_value; }) == threads * iterations);
+}
+
+int main()
+{
+    namespace ut = boost::ut;
+    using namespace ut::literals;
+
+    using Default = decltype(spp::group(std::declval<spp::Sync<Counter>&>()));
+    static_assert(std::same_as<Default, spp::Group<spp::Sync<Counter>>>);
+
+    "Groups in opposite orders don't deadlock"_test = [] {
+        race_opposite_orders<spp::lock_policy::Ordered>();
+        race_opposite_orders<spp::lock_policy::Park>();
+        race_opposite_orders<spp::lock_policy::Backoff<spp::backoff::Exponential<>>>();
+        race_opposite_orders<spp::lock_policy::Backoff<spp::backoff::Yield>>();
+    };
+
+    "Groups of same-typed and mixed mutexes lock in the same order"_test = [] {
+        constexpr auto threads    = 4;
+        constexpr auto iterations = 20'000;
+
+        auto a = spp::Sync<Counter>{};
+        auto b = spp::Sync<Counter>{};
+        auto c = spp::Sync<Counter, std::shared_mutex>{};
+        {
+            auto workers = std::vector<std::jthread>{};
+            for (auto t = 0; t < threads; ++t) {
+                workers.emplace_back([&, t] {
+                    for (auto i = 0; i < iterations; ++i) {
+                        if (t % 2 == 0) {
+                            spp::group(b, a).write([](Counter& y, Counter& x) { ++x.m_value, ++y.m_value; });
+                        } else {
+                            spp::group(c, a, b).write([](Counter&, Counter& x, Counter&) { ++x.m_value; });
+                        }
+                    }
+                });
+            }
+        }
+        ut::expect(a.read([](const Counter& x) { return x.m_value; }) == threads * iterations);
+        ut::expect(b.read([](const Counter& y) { return y.m_value; }) == threads / 2 * iterations);
+    };
+
+    "A retrying group holds nothing while a lock is busy"_test = [] {
+        auto check = []<typename Policy>(std::type_identity<Policy>) {
+            auto a       = spp::Sync<Counter>{};
+            auto b       = spp::Sync<Counter>{};
+            auto held    = std::latch{ 1 };
+            auto release = std::latch{ 1 };
+
+            auto holder = std::jthread{ [&] {
+                b.write([&](Counter&) { held.count_down(), release.wait(); });
+            } };
+            held.wait();
+
+            auto waiter = std::jthread{ [&] {
+                spp::group<Policy>(a, b).write([](Counter& x, Counter& y) { ++x.m_value, ++y.m_value; });
+            } };
+
+            // the waiter only ever holds a for an instant
+            auto free = 0;
+            for (auto i = 0; i < 100; ++i) {
+                free += a.try_write([](Counter&) {}) ? 1 : 0;
+                std::this_thread::sleep_for(100us);
+            }
+            ut::expect(free > 50_i);
+
+            release.count_down();
+            waiter.join();
+            ut::expect(a.read([](const Counter& x) { return x.m_value; }) == 1);
+        };
+
+        check(std::type_identity<spp::lock_policy::Park>{});
+        check(std::type_identity<spp::lock_policy::Backoff<spp::backoff::SpinThenSleep<>>>{});
+    };
+
+    "Bounded waits are unaffected by the policy"_test = [] {
+        auto a = spp::Sync<Counter>{};
+        auto b = spp::Sync<Counter>{};
+
+        auto sum = spp::group<spp::lock_policy::Park>(a, b).try_write([](Counter& x, Counter& y) {
+            return ++x.m_value + ++y.m_value;
+        });
+        ut::expect(sum == 2);
+
+        b.write([&](Counter&) {
+            auto group = spp::group<spp::lock_policy::Backoff<>>(a, b);
+            ut::expect(not group.write_for(5ms, [](Counter&, Counter&) {}));
+            ut::expect(a.try_write([](Counter&) {}));
+        });
+    };
+
+    "Objects sharing an external mutex lock it once"_test = [] {
+        auto mutex = std::mutex{};
+        auto a     = spp::Sync<Counter, std::mutex, false>{ mutex };
+        auto b     = spp::Sync<Counter, std::mutex, false>{ mutex };
+        auto c     = spp::Sync<Counter>{};
+
+        auto sum = spp::group(a, c, b).write([](Counter& x, Counter& y, Counter& z) {
+            return ++x.m_value + ++y.m_value + ++z.m_value;
+        });
+        ut::expect(sum == 3);
+        ut::expect(spp::group<spp::lock_policy::Park>(b, a).try_write([](Counter&, Counter&) {}));
+
+        auto counting = CountingMutex{};
+        auto d        = spp::Sync<Counter, CountingMutex, false>{ counting };
+        auto e        = spp::Sync<Counter, CountingMutex, false>{ counting };
+        spp::group(d, e, d).write([](Counter&, Counter&, Counter&) {});
+        ut::expect(counting.locks() == 1_i);
+    };
+
+    "A shared mutex is locked in the strongest mode requested"_test = [] {
+        auto mutex = std::shared_mutex{};
+        auto a     = spp::Sync<Counter, std::shared_mutex, false>{ mutex };
+        auto b     = spp::Sync<Counter, std::shared_mutex, false>{ mutex };
+        auto& ca   = std::as_const(a);
+
+        auto shared_free = [&] {
+            auto free   = false;
+            auto reader = std::thread{ [&] {
+                free = mutex.try_lock_shared();
+                if (free) {
+                    mutex.unlock_shared();
+                }
+            } };
+            reader.join();
+            return free;
+        };
+
+        spp::group(a, b).read([&](const Counter&, const Counter&) { ut::expect(shared_free()); });
+        spp::group(ca, b).lock([&](const Counter&, Counter&) { ut::expect(not shared_free()); });
+        spp::group(ca, std::as_const(b)).lock([&](const Counter&, const Counter&) {
+            ut::expect(shared_free());
+        });
+    };
+}
@@ -0,0 +1,156 @@
+#include <sync_cpp/sync.hpp>
+#include <sync_cpp/group.hpp>
+#include <sync_cpp/mutex/instrumented_mutex.hpp>
+
+#include <boost/ut.hpp>
+
+#include <chrono>
+#include <latch>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+struct Counter
+{
+    long m_value = 0;
+};
+
+int main()
+{
+    namespace ut = boost::ut;
+    using namespace ut::literals;
+
+    using spp::Histogram;
+
+    "Histogram buckets"_test = [] {
+        for (auto bucket = 0u; bucket < Histogram::bucket_count - 1; ++bucket) {
+            ut::expect(Histogram::bucket_of(Histogram::lower_bound(bucket)) == bucket);
+            ut::expect(Histogram::bucket_of(Histogram::upper_bound(bucket)) == bucket);
+            ut::expect(Histogram::upper_bound(bucket) + 1 == Histogram::lower_bound(bucket + 1));
+        }
+        ut::expect(Histogram::bucket_of(~std::uint64_t{ 0 }) == Histogram::bucket_count - 1);
+
+        // small values are exact, the others have a bounded relative error
+        auto small = Histogram::bucket_of(5);
+        ut::expect(Histogram::lower_bound(small) == 5 and Histogram::upper_bound(small) == 5);
+        for (auto value : { 9ull, 1'000ull, 123'456ull, 987'654'321ull }) {
+            auto bucket = Histogram::bucket_of(value);
+            auto width  = Histogram::upper_bound(bucket) - Histogram::lower_bound(bucket) + 1;
+            ut::expect(width * Histogram::sub_buckets <= value);
+        }
+    };
+
+    "Histogram percentiles"_test = [] {
+        auto histogram = Histogram{};
+        for (auto i = 1u; i <= 100; ++i) {
+            histogram.record(i * 1'000);
+        }
+        ut::expect(histogram.count() == 100);
+        ut::expect(histogram.max() == 100'000);
+        ut::expect(histogram.mean() == 50'500.0);
+
+        auto p50 = histogram.percentile(0.5);
+        ut::expect(p50 >= 50'000 and p50 <= 50'000 * 5 / 4);
+        ut::expect(histogram.percentile(1.0) == 100'000);
+        ut::expect(Histogram{}.percentile(0.99) == 0);
+    };
+
+    "Capabilities are forwarded"_test = [] {
+        using spp::InstrumentedMutex;
+        using namespace spp::concepts;
+
+        ut::expect(SyncMutex<InstrumentedMutex<>>);
+        ut::expect(not SharedLockable<InstrumentedMutex<std::mutex>>);
+        ut::expect(SharedLockable<InstrumentedMutex<std::shared_mutex>>);
+        ut::expect(not TimedLockable<InstrumentedMutex<std::mutex>>);
+        ut::expect(TimedLockable<InstrumentedMutex<std::timed_mutex>>);
+        ut::expect(SharedTimedLockable<InstrumentedMutex<std::shared_timed_mutex>>);
+    };
+
+    "Uncontended acquisitions"_test = [] {
+        auto sync = spp::Sync<Counter, spp::InstrumentedMutex<std::shared_mutex>>{};
+        for (auto i = 0; i < 10; ++i) {
+            sync.write([](Counter& c) { ++c.m_value; });
+        }
+        for (auto i = 0; i < 5; ++i) {
+            std::ignore = sync.read([](const Counter& c) { return c.m_value; });
+        }
+
+        auto stats = sync.mutex().stats();
+        ut::expect(stats.m_exclusive.m_acquisitions == 10);
+        ut::expect(stats.m_exclusive.m_contended == 0);
+        ut::expect(stats.m_exclusive.m_wait.count() == 10);
+        ut::expect(stats.m_exclusive.m_wait.max() == 0);
+        ut::expect(stats.m_exclusive.m_hold.count() == 10);
+
+        ut::expect(stats.m_shared.m_acquisitions == 5);
+        ut::expect(stats.m_shared.m_hold.count() == 5);
+
+        sync.mutex().reset_stats();
+        ut::expect(sync.mutex().stats().m_exclusive.m_acquisitions == 0);
+    };
+
+    "Contended acquisitions and long holds"_test = [] {
+        auto sync = spp::Sync<Counter, spp::InstrumentedMutex<>>{};
+        auto held = std::latch{ 1 };
+
+        auto holder = std::jthread{ [&] {
+            sync.write([&](Counter&) {
+                held.count_down();
+                std::this_thread::sleep_for(20ms);
+            });
+        } };
+        held.wait();
+        sync.write([](Counter& c) { ++c.m_value; });
+        holder.join();
+
+        auto stats = sync.mutex().stats().m_exclusive;
+        ut::expect(stats.m_acquisitions == 2);
+        ut::expect(stats.m_contended == 1);
+        ut::expect(stats.contention_rate() == 0.5);
+        ut::expect(stats.m_wait.max() >= 10'000'000);
+        ut::expect(stats.m_hold.max() >= 20'000'000);
+    };
+
+    "A recursive mutex records the outermost hold"_test = [] {
+        auto mutex = spp::InstrumentedMutex<std::recursive_mutex>{};
+
+        mutex.lock();
+        std::this_thread::sleep_for(20ms);
+        mutex.lock();    // would restart the hold
+        mutex.unlock();
+        std::this_thread::sleep_for(5ms);
+        mutex.unlock();
+
+        auto stats = mutex.stats().m_exclusive;
+        ut::expect(stats.m_acquisitions == 2);
+        ut::expect(stats.m_hold.count() == 1);
+        ut::expect(stats.m_hold.max() >= 25'000'000);
+    };
+
+    "Statistics of concurrent threads add up"_test = [] {
+        auto a       = spp::Sync<Counter, spp::InstrumentedMutex<std::shared_mutex>>{};
+        auto b       = spp::Sync<Counter, spp::InstrumentedMutex<std::shared_mutex>>{};
+        auto threads = std::vector<std::jthread>{};
+        for (auto t = 0; t < 8; ++t) {
+            threads.emplace_back([&] {
+                for (auto i = 0; i < 1'000; ++i) {
+                    spp::group(a, b).write([](Counter& x, Counter& y) { ++x.m_value, ++y.m_value; });
+                    std::ignore = a.read([](const Counter& c) { return c.m_value; });
+                }
+            });
+        }
+        threads.clear();
+
+        auto stats = a.mutex().stats();
+        ut::expect(stats.m_exclusive.m_acquisitions == 8'000);
+        ut::expect(stats.m_exclusive.m_hold.count() == 8'000);
+        ut::expect(stats.m_shared.m_acquisitions == 8'000);
+        ut::expect(stats.m_shared.m_hold.count() == 8'000);
+        ut::expect(b.mutex().stats().m_shared.m_acquisitions == 0);
+    };
+}
@@ -0,0 +1,290 @@
+#include <sync_cpp/sync.hpp>
+#include <sync_cpp/group.hpp>
+#include <sync_cpp/mutex/spin_lock.hpp>
+#include <sync_cpp/mutex/ticket_lock.hpp>
+#include <sync_cpp/mutex/mcs_lock.hpp>
+#include <sync_cpp/mutex/parking_mutex.hpp>
+#include <sync_cpp/mutex/big_reader_mutex.hpp>
+#include <sync_cpp/sync_opt.hpp>
+#include <sync_cpp/sync_smart_ptr.hpp>
+
+#include <boost/ut.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+struct Counter
+{
+    long m_value = 0;
+};
+
+// a Lockable that is not derived from any standard mutex
+class ForeignMutex
+{
+public:
+    void lock() { m_mutex.lock(); }
+    void unlock() { m_mutex.unlock(); }
+    bool try_lock() { return m_mutex.try_lock(); }
+
+private:
+    std::mutex m_mutex;
+};
+
+// a SharedLockable that is not derived from any standard mutex, counts shared acquisitions
+class ForeignSharedMutex
+{
+public:
+    void lock() { m_mutex.lock(); }
+    void unlock() { m_mutex.unlock(); }
+    bool try_lock() { return m_mutex.try_lock(); }
+
+    void lock_shared()
+    {
+        m_mutex.lock_shared();
+        ++m_shared_count;
+    }
+    void unlock_shared() { m_mutex.unlock_shared(); }
+    bool try_lock_shared() { return m_mutex.try_lock_shared(); }
+
+    int m_shared_count = 0;
+
+private:
+    std::shared_mutex m_mutex;
+};
+
+int main()
+{
+    namespace ut = boost::ut;
+    using namespace ut::literals;
+
+    using spp::concepts::SyncMutex;
+    using spp::concepts::SharedLockable;
+
+    "SyncMutex accepts any Lockable"_test = [] {
+        ut::expect(SyncMutex<std::mutex>);
+        ut::expect(SyncMutex<std::timed_mutex>);
+        ut::expect(SyncMutex<ForeignMutex>);
+        ut::expect(SyncMutex<spp::SpinLock<>>);
+        ut::expect(SyncMutex<spp::TicketLock<>>);
+        ut::expect(SyncMutex<spp::McsLock<>>);
+        ut::expect(SyncMutex<spp::ParkingMutex>);
+        ut::expect(SyncMutex<spp::ParkingSharedMutex>);
+        ut::expect(SyncMutex<spp::ParkingUpgradeMutex>);
+
+        ut::expect(not SyncMutex<const std::mutex>);
+        ut::expect(not SyncMutex<std::mutex&>);
+        ut::expect(not SyncMutex<int>);
+
+        ut::expect(SharedLockable<std::shared_mutex>);
+        ut::expect(SharedLockable<ForeignSharedMutex>);
+        ut::expect(SharedLockable<spp::ParkingSharedMutex>);
+        ut::expect(not SharedLockable<spp::SpinLock<>>);
+        ut::expect(not SharedLockable<spp::ParkingMutex>);
+    };
+
+    "Shared capability is detected by concept"_test = [] {
+        auto sync = spp::Sync<Counter, ForeignSharedMutex>{};
+        std::ignore = sync.read([](const Counter& c) { return c.m_value; });
+        ut::expect(sync.mutex().m_shared_count == 1);
+
+        auto other = spp::Sync<Counter, ForeignSharedMutex>{};
+        std::ignore = spp::group(sync, other).read([](const Counter&, const Counter&) { return 0; });
+        ut::expect(sync.mutex().m_shared_count == 2);
+        ut::expect(other.mutex().m_shared_count == 1);
+    };
+
+    auto hammer = []<typename M>(std::type_identity<M>) {
+        auto sync    = spp::Sync<Counter, M>{};
+        auto threads = std::vector<std::jthread>{};
+        for (auto t = 0; t < 4; ++t) {
+            threads.emplace_back([&] {
+                for (auto i = 0; i < 20'000; ++i) {
+                    sync.write([](Counter& c) { ++c.m_value; });
+                }
+            });
+        }
+        threads.clear();
+        return sync.get(&Counter::m_value);
+    };
+
+    auto exclusive = []<typename M>(std::type_identity<M>) {
+        auto mutex = M{};
+        ut::expect(mutex.try_lock());
+        auto other = std::jthread{ [&] { ut::expect(not mutex.try_lock()); } };
+        other.join();
+        mutex.unlock();
+        ut::expect(mutex.try_lock());
+        mutex.unlock();
+    };
+
+    "SpinLock"_test = [&] {
+        exclusive(std::type_identity<spp::SpinLock<>>{});
+        ut::expect(hammer(std::type_identity<spp::SpinLock<>>{}) == 80'000);
+        ut::expect(hammer(std::type_identity<spp::SpinLock<spp::backoff::Yield>>{}) == 80'000);
+    };
+
+    "TicketLock"_test = [&] {
+        exclusive(std::type_identity<spp::TicketLock<>>{});
+        ut::expect(hammer(std::type_identity<spp::TicketLock<spp::backoff::SpinThenYield<>>>{}) == 80'000);
+    };
+
+    "McsLock"_test = [&] {
+        exclusive(std::type_identity<spp::McsLock<>>{});
+        ut::expect(hammer(std::type_identity<spp::McsLock<spp::backoff::SpinThenYield<>>>{}) == 80'000);
+
+        // a thread may hold several MCS locks at once
+        auto a = spp::Sync<Counter, spp::McsLock<>>{};
+        auto b = spp::Sync<Counter, spp::McsLock<>>{};
+        auto sum = spp::group(a, b).write([](Counter& x, Counter& y) { return ++x.m_value + ++y.m_value; });
+        ut::expect(sum == 2);
+    };
+
+    "ParkingMutex"_test = [&] {
+        ut::expect(sizeof(spp::ParkingMutex) == 1);
+        ut::expect(sizeof(spp::Sync<Counter, spp::ParkingMutex>) == 2 * sizeof(Counter));
+
+        exclusive(std::type_identity<spp::ParkingMutex>{});
+        ut::expect(hammer(std::type_identity<spp::ParkingMutex>{}) == 80'000);
+
+        auto opt = spp::SyncOpt<Counter, spp::ParkingMutex>{};
+        auto ptr = spp::SyncUnique<Counter, spp::ParkingMutex>{ std::make_unique<Counter>() };
+        opt.write_value([](Counter& c) { c.m_value = 1; });
+        ptr.write_value([](Counter& c) { c.m_value = 2; });
+        ut::expect(opt.get_value(&Counter::m_value) + ptr.get_value(&Counter::m_value) == 3);
+    };
+
+    "ParkingSharedMutex"_test = [&] {
+        ut::expect(sizeof(spp::ParkingSharedMutex) == 4);
+
+        exclusive(std::type_identity<spp::ParkingSharedMutex>{});
+        ut::expect(hammer(std::type_identity<spp::ParkingSharedMutex>{}) == 80'000);
+
+        // readers share the lock, but exclude a writer
+        auto mutex = spp::ParkingSharedMutex{};
+        mutex.lock_shared();
+        ut::expect(mutex.try_lock_shared());
+        ut::expect(not mutex.try_lock());
+        mutex.unlock_shared();
+        mutex.unlock_shared();
+        ut::expect(mutex.try_lock());
+        ut::expect(not mutex.try_lock_shared());
+        mutex.unlock();
+
+        // readers never observe a half-done write
+        auto sync    = spp::Sync<Counter, spp::ParkingSharedMutex>{};
+        auto torn    = std::atomic<bool>{ false };
+        auto threads = std::vector<std::jthread>{};
+        for (auto t = 0; t < 4; ++t) {
+            threads.emplace_back([&, t] {
+                for (auto i = 0; i < 20'000; ++i) {
+                    if (t % 2 == 0) {
+                        sync.write([](Counter& c) { c.m_value += 2; });
+                    } else if (sync.read([](const Counter& c) { return c.m_value % 2 != 0; })) {
+                        torn = true;
+                    }
+                }
+            });
+        }
+        threads.clear();
+        ut::expect(not torn.load());
+        ut::expect(sync.get(&Counter::m_value) == 80'000);
+    };
+
+    "BigReaderMutex"_test = [&] {
+        using Mutex = spp::BigReaderMutex<8>;
+        ut::expect(spp::concepts::SharedLockable<Mutex>);
+
+        exclusive(std::type_identity<Mutex>{});
+        ut::expect(hammer(std::type_identity<Mutex>{}) == 80'000);
+
+        // readers of any slot share the lock, but exclude a writer
+        auto mutex  = Mutex{};
+        auto shared = [&](bool expected) {
+            auto other = std::jthread{ [&] {
+                auto locked = mutex.try_lock_shared();
+                ut::expect(locked == expected);
+                if (locked) {
+                    mutex.unlock_shared();
+                }
+            } };
+        };
+        mutex.lock_shared();
+        ut::expect(mutex.try_lock_shared());
+        shared(true);
+        ut::expect(not mutex.try_lock());
+        mutex.unlock_shared();
+        mutex.unlock_shared();
+        ut::expect(mutex.try_lock());
+        shared(false);
+        mutex.unlock();
+
+        // a writer waits for the readers of every slot
+        auto sync    = spp::Sync<Counter, Mutex>{};
+        auto torn    = std::atomic<bool>{ false };
+        auto threads = std::vector<std::jthread>{};
+        for (auto t = 0; t < 12; ++t) {
+            threads.emplace_back([&, t] {
+                for (auto i = 0; i < 5'000; ++i) {
+                    if (t % 4 == 0) {
+                        sync.write([](Counter& c) { c.m_value += 2; });
+                    } else if (sync.read([](const Counter& c) { return c.m_value % 2 != 0; })) {
+                        torn = true;
+                    }
+                }
+            });
+        }
+        threads.clear();
+        ut::expect(not torn.load());
+        ut::expect(sync.get(&Counter::m_value) == 30'000);
+    };
+
+    "ParkingUpgradeMutex"_test = [&] {
+        ut::expect(sizeof(spp::ParkingUpgradeMutex) == 4);
+
+        exclusive(std::type_identity<spp::ParkingUpgradeMutex>{});
+        ut::expect(hammer(std::type_identity<spp::ParkingUpgradeMutex>{}) == 80'000);
+
+        // the upgrade lock is shared with readers only
+        auto mutex = spp::ParkingUpgradeMutex{};
+        mutex.lock_upgrade();
+        ut::expect(mutex.try_lock_shared());
+        ut::expect(not mutex.try_lock_upgrade());
+        ut::expect(not mutex.try_lock());
+        mutex.unlock_shared();
+
+        // upgrading holds back new readers until the old ones leave
+        mutex.lock_shared();
+        auto upgraded = std::atomic<bool>{ false };
+        auto upgrader = std::jthread{ [&] {
+            mutex.unlock_upgrade_and_lock();
+            upgraded = true;
+        } };
+        while (mutex.try_lock_shared()) {
+            mutex.unlock_shared();
+            std::this_thread::yield();
+        }
+        ut::expect(not upgraded.load());
+        mutex.unlock_shared();
+        upgrader.join();
+        ut::expect(upgraded.load());
+
+        // downgrading lets readers in, not writers
+        mutex.unlock_and_lock_shared();
+        ut::expect(mutex.try_lock_shared());
+        ut::expect(not mutex.try_lock());
+        mutex.unlock_shared();
+        mutex.unlock_shared();
+
+        mutex.lock_upgrade();
+        mutex.unlock_upgrade_and_lock_shared();
+        ut::expect(mutex.try_lock_upgrade());
+        mutex.unlock_upgrade();
+        mutex.unlock_shared();
+        ut::expect(mutex.try_lock());
+        mutex.unlock();
+    };
+}
@@ -0,0 +1,122 @@
+#include <sync_cpp/sync.hpp>
+#include <sync_cpp/sync_opt.hpp>
+#include <sync_cpp/sync_smart_ptr.hpp>
+#include <sync_cpp/registry.hpp>
+#include <sync_cpp/mutex/instrumented_mutex.hpp>
+
+#include <boost/ut.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <latch>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <tuple>
+
+using namespace std::chrono_literals;
+
+struct Counter
+{
+    long m_value = 0;
+};
+
+using Instrumented = spp::InstrumentedMutex<std::shared_mutex>;
+
+// make one contended write on the object
+void contend(auto& sync)
+{
+    auto held   = std::latch{ 1 };
+    auto holder = std::jthread{ [&] {
+        sync.write([&](auto&) {
+            held.count_down();
+            std::this_thread::sleep_for(5ms);
+        });
+    } };
+    held.wait();
+    sync.write([](auto&) {});
+}
+
+int main()
+{
+    namespace ut = boost::ut;
+    using namespace ut::literals;
+
+    "Only instrumented objects can enroll"_test = [] {
+        auto can_enroll = []<typename S>(std::type_identity<S>) {
+            return requires (spp::Registry& registry, const S& sync) { registry.enroll("name", sync); };
+        };
+        ut::expect(can_enroll(std::type_identity<spp::Sync<Counter, Instrumented>>{}));
+        ut::expect(can_enroll(std::type_identity<spp::SyncOpt<Counter, Instrumented>>{}));
+        ut::expect(can_enroll(std::type_identity<spp::SyncUnique<Counter, Instrumented>>{}));
+        ut::expect(not can_enroll(std::type_identity<spp::Sync<Counter>>{}));
+    };
+
+    "Entries are aggregated by name, hottest first"_test = [] {
+        auto registry = spp::Registry{};
+
+        auto a   = spp::Sync<Counter, Instrumented>{};
+        auto b   = spp::SyncOpt<Counter, Instrumented>{ Counter{} };
+        auto c   = spp::Sync<Counter, Instrumented>{};
+        auto r_a = registry.enroll("cold", a);
+        auto r_b = registry.enroll("hot", b);
+        auto r_c = registry.enroll("cold", c);
+
+        a.write([](Counter& v) { ++v.m_value; });
+        c.write([](Counter& v) { ++v.m_value; });
+        contend(b);
+
+        auto entries = registry.collect();
+        ut::expect(entries.size() == 2);
+        ut::expect(entries[0].m_name == "hot" and entries[0].contended() == 1);
+        ut::expect(entries[1].m_name == "cold" and entries[1].m_objects == 2);
+        ut::expect(entries[1].m_stats.m_exclusive.m_acquisitions == 2);
+
+        ut::expect(registry.collect(1).size() == 1);
+
+        r_b.reset();
+        ut::expect(registry.collect().size() == 1);
+        {
+            auto moved = std::move(r_a);
+        }
+        ut::expect(registry.collect()[0].m_objects == 1);
+    };
+
+    "Prometheus report"_test = [] {
+        auto registry = spp::Registry{};
+        auto sync     = spp::Sync<Counter, Instrumented>{};
+        auto enrolled = registry.enroll("sessions \"main\"", sync);
+
+        contend(sync);
+        std::ignore = sync.read([](const Counter& c) { return c.m_value; });
+
+        auto report   = registry.prometheus();
+        auto labels   = std::string{ "{name=\"sessions \\\"main\\\"\",mode=\"exclusive\"}" };
+        auto shared   = std::string{ "{name=\"sessions \\\"main\\\"\",mode=\"shared\"}" };
+        auto contains = [&](const std::string& line) { return report.find(line) != std::string::npos; };
+
+        ut::expect(contains("# TYPE sync_cpp_lock_acquisitions_total counter\n"));
+        ut::expect(contains("sync_cpp_lock_acquisitions_total" + labels + " 2\n")) << report;
+        ut::expect(contains("sync_cpp_lock_contended_total" + labels + " 1\n"));
+        ut::expect(contains("sync_cpp_lock_contention_ratio" + labels + " 0.5\n"));
+        ut::expect(contains("# TYPE sync_cpp_lock_hold_seconds summary\n"));
+        ut::expect(contains("sync_cpp_lock_hold_seconds_count" + labels + " 2\n"));
+        ut::expect(contains("quantile=\"0.99\"}"));
+        ut::expect(contains("sync_cpp_lock_hold_max_seconds" + labels + " 0.00"));
+        ut::expect(contains("sync_cpp_lock_acquisitions_total" + shared + " 1\n"));
+    };
+
+    "A trigger runs the report on its own thread"_test = [] {
+        auto reports = std::atomic<int>{ 0 };
+        auto trigger = spp::ReportTrigger{ [&] { reports.fetch_add(1); }, 1ms };
+
+        std::this_thread::sleep_for(10ms);
+        ut::expect(reports.load() == 0);
+
+        trigger.request();
+        for (auto i = 0; i < 1'000 and reports.load() == 0; ++i) {
+            std::this_thread::sleep_for(1ms);
+        }
+        ut::expect(reports.load() == 1);
+    };
+}
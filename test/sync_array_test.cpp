@@ -0,0 +1,81 @@
+#include <sync_cpp/sync_array.hpp>
+
+#include <boost/ut.hpp>
+
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct Stats
+{
+    std::uint64_t m_count = 0;
+};
+
+template <typename T>
+std::uintptr_t address(const T& t)
+{
+    return reinterpret_cast<std::uintptr_t>(&t);
+}
+
+int main()
+{
+    namespace ut = boost::ut;
+    using namespace ut::literals;
+
+    using spp::Sync;
+    using spp::SyncLayout;
+
+    constexpr auto cache_line = spp::detail::cache_line_size;
+
+    "Layout policies"_test = [&] {
+        using Compact  = Sync<Stats, std::mutex, true, SyncLayout::Compact>;
+        using Isolated = Sync<Stats, std::mutex, true, SyncLayout::Isolated>;
+        using Padded   = Sync<Stats, std::mutex, true, SyncLayout::Padded>;
+
+        ut::expect(sizeof(Compact) == sizeof(Stats) + sizeof(std::mutex));
+
+        ut::expect(alignof(Padded) == cache_line);
+        ut::expect(sizeof(Padded) % cache_line == 0);
+
+        auto isolated = Isolated{};
+        auto distance = address(isolated.mutex()) - address(isolated);
+        ut::expect(distance >= cache_line);
+        ut::expect(address(isolated.mutex()) % cache_line == 0);
+    };
+
+    "Elements don't share cache lines"_test = [&] {
+        auto array = spp::SyncArray<Stats, 4>{};
+        for (auto i = 1u; i < array.size(); ++i) {
+            ut::expect(address(array[i]) - address(array[i - 1]) >= cache_line);
+            ut::expect(address(array[i]) % cache_line == 0);
+        }
+    };
+
+    "Construct every element from the same arguments"_test = [] {
+        auto array = spp::SyncArray<Stats, 3>{ 42u };
+        for (const auto& element : array) {
+            ut::expect(element.get(&Stats::m_count) == 42u);
+        }
+        ut::expect(ut::throws([&] { std::ignore = array.at(3); }));
+    };
+
+    "Per-thread slots"_test = [] {
+        auto array   = spp::SyncArray<Stats, 4>{};
+        auto threads = std::vector<std::jthread>{};
+        for (auto t = 0u; t < array.size(); ++t) {
+            threads.emplace_back([&, t] {
+                for (auto i = 0; i < 10'000; ++i) {
+                    array[t].write([](Stats& s) { ++s.m_count; });
+                }
+            });
+        }
+        threads.clear();
+
+        auto total = std::uint64_t{ 0 };
+        for (const auto& element : array) {
+            total += element.get(&Stats::m_count);
+        }
+        ut::expect(total == 40'000u);
+    };
+}
@@ -0,0 +1,179 @@
+#include <sync_cpp/sync_async.hpp>
+#include <sync_cpp/mutex/async_mutex.hpp>
+#include <sync_cpp/thread_pool.hpp>
+
+#include <boost/ut.hpp>
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <latch>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+struct Counter
+{
+    long m_value = 0;
+};
+
+// a coroutine that starts right away and nobody waits for
+struct Detached
+{
+    struct promise_type
+    {
+        Detached           get_return_object() { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void               return_void() {}
+        [[noreturn]] void  unhandled_exception() { std::terminate(); }
+    };
+};
+
+int main()
+{
+    namespace ut = boost::ut;
+    using namespace ut::literals;
+
+    "An uncontended access doesn't suspend"_test = [] {
+        auto text   = spp::SyncAsync<std::string>{ "hello" };
+        auto result = std::string{};
+
+        [&]() -> Detached {
+            auto size = co_await text.async_write([](std::string& s) {
+                s += " world";
+                return s.size();
+            });
+            result = co_await text.async_read([&](const std::string& s) { return s.substr(0, size - 6); });
+        }();
+        ut::expect(result == "hello");
+        ut::expect(text.try_read([](const std::string& s) { return s.size(); }) == 11ul);
+    };
+
+    "A waiting coroutine gives its thread back"_test = [] {
+        auto counter = spp::SyncAsync<Counter>{};
+        auto events  = std::vector<std::string>{};
+
+        auto increment = [&]() -> Detached {
+            events.push_back("waiting");
+            co_await counter.async_write([](Counter& c) { ++c.m_value; });
+            events.push_back("done");
+        };
+
+        std::ignore = counter.try_write([&](Counter&) {
+            increment();
+            events.push_back("returned");
+        });
+        ut::expect(events == std::vector<std::string>{ "waiting", "returned", "done" });
+        ut::expect(counter.try_read([](const Counter& c) { return c.m_value; }) == 1l);
+    };
+
+    "Exceptions reach the awaiting coroutine and release the lock"_test = [] {
+        auto counter = spp::SyncAsync<Counter>{};
+        auto caught  = false;
+
+        [&]() -> Detached {
+            try {
+                co_await counter.async_write([](Counter&) { throw std::runtime_error{ "failed" }; });
+            } catch (const std::runtime_error&) {
+                caught = true;
+            }
+        }();
+        ut::expect(caught);
+        ut::expect(counter.try_write([](Counter&) {}));
+    };
+
+    "Queued readers are resumed together, in order with the writers"_test = [] {
+        auto mutex  = spp::AsyncSharedMutex{};
+        auto events = std::string{};
+
+        // the coroutines keep the lock, the test releases it
+        auto reader = [&]() -> Detached {
+            co_await mutex.lock_shared_async();
+            events += 'r';
+        };
+        auto writer = [&]() -> Detached {
+            co_await mutex.lock_async();
+            events += 'w';
+        };
+
+        ut::expect(mutex.try_lock());
+        reader();
+        reader();
+        writer();
+        reader();
+        ut::expect(events.empty());
+        ut::expect(not mutex.try_lock_shared());    // and the others are queued
+
+        mutex.unlock();
+        ut::expect(events == "rr");
+        mutex.unlock_shared();
+        ut::expect(events == "rr");
+        mutex.unlock_shared();
+        ut::expect(events == "rrw");
+        mutex.unlock();
+        ut::expect(events == "rrwr");
+        mutex.unlock_shared();
+        ut::expect(mutex.try_lock());
+        mutex.unlock();
+    };
+
+    "A long queue of waiters is resumed without growing the stack"_test = [] {
+        constexpr auto coroutines = 200'000;
+
+        auto mutex = spp::AsyncSharedMutex{};
+        auto done  = 0;
+
+        // each one releases the lock to the next while being resumed by the release of the previous one
+        auto waiter = [&]() -> Detached {
+            co_await mutex.lock_async();
+            ++done;
+            mutex.unlock();
+        };
+
+        ut::expect(mutex.try_lock());
+        for (auto i = 0; i < coroutines; ++i) {
+            waiter();
+        }
+        mutex.unlock();
+
+        ut::expect(done == coroutines);
+        ut::expect(mutex.try_lock());
+        mutex.unlock();
+    };
+
+    "Waiters are resumed through the executor"_test = [] {
+        constexpr auto threads    = 4;
+        constexpr auto coroutines = 2'000;
+
+        auto finished = std::latch{ threads * coroutines };
+        auto positive = std::atomic<int>{ 0 };
+        auto pool     = spp::ThreadPool{ 4 };
+        auto executor = [&](std::coroutine_handle<> handle) { pool.post([handle] { handle.resume(); }); };
+        auto counter  = spp::SyncAsync<Counter>{ executor };
+
+        auto increment = [&]() -> Detached {
+            co_await counter.async_write([](Counter& c) { ++c.m_value; });
+            auto value = co_await counter.async_read([](const Counter& c) { return c.m_value; });
+            positive.fetch_add(value > 0 ? 1 : 0);
+            finished.count_down();
+        };
+        {
+            auto starters = std::vector<std::jthread>{};
+            for (auto t = 0; t < threads; ++t) {
+                starters.emplace_back([&] {
+                    for (auto i = 0; i < coroutines; ++i) {
+                        increment();
+                    }
+                });
+            }
+        }
+        finished.wait();
+
+        auto total = counter.try_read([](const Counter& c) { return c.m_value; });
+        ut::expect(total == long{ threads * coroutines });
+        ut::expect(positive.load() == threads * coroutines);
+    };
+}
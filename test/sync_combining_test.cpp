@@ -0,0 +1,82 @@
+#include <sync_cpp/sync_combining.hpp>
+#include <sync_cpp/mutex/parking_mutex.hpp>
+
+#include <boost/ut.hpp>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct Counter
+{
+    long m_value = 0;
+};
+
+int main()
+{
+    namespace ut = boost::ut;
+    using namespace ut::literals;
+
+    "Every caller gets its own result"_test = [] {
+        auto hammer = []<typename Combining>(Combining& counter) {
+            constexpr auto threads    = 8;
+            constexpr auto iterations = 10'000;
+
+            auto tickets = std::vector<std::vector<long>>(threads);
+            {
+                auto workers = std::vector<std::jthread>{};
+                for (auto t = 0; t < threads; ++t) {
+                    workers.emplace_back([&, t] {
+                        for (auto i = 0; i < iterations; ++i) {
+                            tickets[t].push_back(counter.write([](Counter& c) { return c.m_value++; }));
+                        }
+                    });
+                }
+            }
+
+            auto all = std::vector<long>{};
+            for (const auto& mine : tickets) {
+                ut::expect(std::ranges::is_sorted(mine));
+                all.insert(all.end(), mine.begin(), mine.end());
+            }
+            std::ranges::sort(all);
+            ut::expect(std::ranges::adjacent_find(all) == all.end()) << "a ticket was handed out twice";
+            ut::expect(counter.get(&Counter::m_value) == threads * iterations);
+        };
+
+        auto counter = spp::SyncCombining<Counter>{};
+        hammer(counter);
+
+        // more threads than slots, some of them run their functions themselves
+        auto crowded = spp::SyncCombining<Counter, spp::ParkingMutex, 2>{};
+        hammer(crowded);
+    };
+
+    "Results, void functions and move-only results"_test = [] {
+        auto map = spp::SyncCombining<std::map<int, std::string>>{};
+
+        map.write([](auto& m) { m.emplace(1, "one"); });
+        ut::expect(map.read([](const auto& m) { return m.at(1); }) == "one");
+
+        auto owned = map.read([](const auto& m) { return std::make_unique<std::size_t>(m.size()); });
+        ut::expect(*owned == 1);
+
+        map = std::map<int, std::string>{ { 2, "two" } };
+        ut::expect(map.read([](const auto& m) { return m.contains(2) and not m.contains(1); }));
+    };
+
+    "Exceptions are rethrown to the caller"_test = [] {
+        auto counter = spp::SyncCombining<Counter>{};
+        ut::expect(ut::throws([&] {
+            counter.write([](Counter& c) {
+                ++c.m_value;
+                throw std::runtime_error{ "failed" };
+            });
+        }));
+        ut::expect(counter.get(&Counter::m_value) == 1);
+    };
+}
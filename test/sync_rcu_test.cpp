@@ -0,0 +1,155 @@
+#include <sync_cpp/sync_rcu.hpp>
+
+#include <boost/ut.hpp>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct Table
+{
+    inline static std::atomic<int> s_alive{ 0 };
+
+    std::vector<int> m_entries;
+    std::string      m_name;
+
+    Table(std::size_t size, std::string name)
+        : m_entries(size, 0)
+        , m_name{ std::move(name) }
+    {
+        ++s_alive;
+    }
+
+    Table(const Table& other)
+        : m_entries{ other.m_entries }
+        , m_name{ other.m_name }
+    {
+        ++s_alive;
+    }
+
+    ~Table() { --s_alive; }
+
+    bool consistent() const
+    {
+        for (auto entry : m_entries) {
+            if (entry != m_entries.front()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    int  front() const noexcept { return m_entries.front(); }
+    void fill(int value)
+    {
+        for (auto& entry : m_entries) {
+            entry = value;
+        }
+    }
+};
+
+int main()
+{
+    namespace ut = boost::ut;
+    using namespace ut::literals;
+
+    "Basic operations"_test = [] {
+        {
+            auto rcu = spp::SyncRcu<Table>{ 4u, "table" };
+
+            ut::expect(rcu.get(&Table::m_name) == "table");
+            ut::expect(rcu.read(&Table::front) == 0);
+
+            rcu.write(&Table::fill, 3);
+            ut::expect(rcu.read([](const Table& t) { return t.front() + t.m_entries.back(); }) == 6);
+
+            auto size = rcu.write([](Table& t) {
+                t.m_entries.push_back(3);
+                return t.m_entries.size();
+            });
+            ut::expect(size == 5u);
+
+            // no reader is active: every retired snapshot is reclaimed on write
+            ut::expect(Table::s_alive == 1);
+        }
+        ut::expect(Table::s_alive == 0);
+    };
+
+    "Failed write publishes nothing"_test = [] {
+        auto rcu = spp::SyncRcu<Table>{ 2u, "table" };
+        ut::expect(ut::throws([&] {
+            rcu.write([](Table& t) {
+                t.fill(9);
+                throw 42;
+            });
+        }));
+        ut::expect(rcu.read(&Table::front) == 0);
+    };
+
+    "Readers keep their snapshot while writers publish"_test = [] {
+        auto rcu = spp::SyncRcu<Table>{ 64u, "table" };
+
+        // a reader holding a snapshot does not block the writer, and still sees the old version
+        rcu.read([&](const Table& snapshot) {
+            auto writer = std::jthread{ [&] { rcu.write(&Table::fill, 1); } };
+            writer.join();
+
+            ut::expect(snapshot.front() == 0);
+            ut::expect(rcu.read(&Table::front) == 1);
+            ut::expect(Table::s_alive == 2);    // old snapshot can't be reclaimed yet
+        });
+
+        rcu.write(&Table::fill, 2);
+        ut::expect(Table::s_alive == 1);
+    };
+
+    "Nested reads beyond the slots"_test = [] {
+        auto rcu = spp::SyncRcu<Table, std::mutex, 1>{ 8u, "table" };
+
+        // the inner read finds the only slot taken and enters through the overflow counter
+        rcu.read([&](const Table&) {
+            rcu.read([&](const Table& snapshot) {
+                auto writer = std::jthread{ [&] { rcu.write(&Table::fill, 1); } };
+                writer.join();
+
+                ut::expect(snapshot.front() == 0);
+                ut::expect(Table::s_alive == 2);    // old snapshot can't be reclaimed yet
+            });
+        });
+
+        rcu.write(&Table::fill, 2);
+        ut::expect(Table::s_alive == 1);
+    };
+
+    "Concurrent readers and writers"_test = [] {
+        auto rcu          = spp::SyncRcu<Table, std::mutex, 4>{ 256u, "table" };
+        auto stop         = std::atomic<bool>{ false };
+        auto inconsistent = std::atomic<int>{ 0 };
+
+        auto readers = std::vector<std::jthread>{};
+        for (auto i = 0; i < 6; ++i) {    // more readers than slots
+            readers.emplace_back([&] {
+                while (not stop) {
+                    if (not rcu.read(&Table::consistent)) {
+                        ++inconsistent;
+                    }
+                }
+            });
+        }
+
+        auto writers = std::vector<std::jthread>{};
+        for (auto i = 0; i < 2; ++i) {
+            writers.emplace_back([&, i] {
+                for (auto n = 0; n < 2'000; ++n) {
+                    rcu.write(&Table::fill, n * 2 + i);
+                }
+            });
+        }
+        writers.clear();
+        stop = true;
+        readers.clear();
+
+        ut::expect(inconsistent == 0);
+    };
+}
@@ -0,0 +1,71 @@
+#include <sync_cpp/sync_seqlock.hpp>
+
+#include <boost/ut.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+struct Pair
+{
+    std::int64_t m_first  = 0;
+    std::int64_t m_second = 0;
+    char         m_tag    = 'a';    // makes the size not a multiple of a word
+
+    std::int64_t sum() const noexcept { return m_first + m_second; }
+    std::int64_t bump(std::int64_t v)
+    {
+        m_first  += v;
+        m_second -= v;
+        return m_first;
+    }
+};
+
+int main()
+{
+    namespace ut = boost::ut;
+    using namespace ut::literals;
+
+    "Basic operations"_test = [] {
+        auto seq = spp::SyncSeqlock<Pair>{ 1, -1, 'z' };
+
+        ut::expect(seq.get(&Pair::m_first) == 1);
+        ut::expect(seq.get(&Pair::m_tag) == 'z');
+        ut::expect(seq.read(&Pair::sum) == 0);
+        ut::expect(seq.write(&Pair::bump, 41) == 42);
+        ut::expect(seq.read([](const Pair& p) { return p.m_second; }) == -42);
+
+        seq.write([](Pair& p) { p.m_tag = 'q'; });
+        ut::expect(seq.load().m_tag == 'q');
+
+        seq = Pair{ 7, 8, 'x' };
+        ut::expect(seq.read(&Pair::sum) == 15);
+    };
+
+    "Readers never observe a torn value"_test = [] {
+        auto seq  = spp::SyncSeqlock<Pair>{};
+        auto stop = std::atomic<bool>{ false };
+        auto torn = std::atomic<int>{ 0 };
+
+        auto readers = std::vector<std::jthread>{};
+        for (auto i = 0; i < 3; ++i) {
+            readers.emplace_back([&] {
+                while (not stop.load()) {
+                    if (seq.read(&Pair::sum) != 0) {
+                        ++torn;
+                    }
+                }
+            });
+        }
+
+        for (auto i = 0; i < 100'000; ++i) {
+            std::ignore = seq.write(&Pair::bump, 3);
+        }
+        stop = true;
+        readers.clear();
+
+        ut::expect(torn == 0);
+        ut::expect(seq.get(&Pair::m_first) == 300'000);
+    };
+}
@@ -0,0 +1,81 @@
+#include <sync_cpp/sync_sharded_map.hpp>
+
+#include <boost/ut.hpp>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+int main()
+{
+    namespace ut = boost::ut;
+    using namespace ut::literals;
+
+    "Per-key operations"_test = [] {
+        auto map = spp::SyncShardedMap<std::string, int>{};
+
+        ut::expect(map.try_emplace("one", 1));
+        ut::expect(map.try_emplace("two", 2));
+        ut::expect(not map.try_emplace("one", 100));
+
+        ut::expect(map.contains("one"));
+        ut::expect(not map.contains("three"));
+
+        auto one = map.read("one", [](const int& v) { return v * 10; });
+        ut::expect(one.has_value() and *one == 10);
+        ut::expect(not map.read("three", [](const int& v) { return v; }).has_value());
+
+        ut::expect(map.write("two", [](int& v) { v += 40; }));
+        ut::expect(not map.write("three", [](int& v) { v += 40; }));
+        ut::expect(map.read("two", [](const int& v) { return v; }) == 42);
+
+        ut::expect(map.erase("one"));
+        ut::expect(not map.erase("one"));
+        ut::expect(map.size() == 1u);
+
+        map.clear();
+        ut::expect(map.size() == 0u);
+    };
+
+    "Shard index is stable and in range"_test = [] {
+        using Map = spp::SyncShardedMap<int, int, 8>;
+        for (auto i = 0; i < 1'000; ++i) {
+            ut::expect(Map::shard_index(i) < Map::shard_count());
+            ut::expect(Map::shard_index(i) == Map::shard_index(i));
+        }
+    };
+
+    "Whole-map iteration"_test = [] {
+        auto map = spp::SyncShardedMap<int, int, 4>{};
+        for (auto i = 0; i < 100; ++i) {
+            map.try_emplace(i, i);
+        }
+
+        map.write_all([](const int&, int& v) { v *= 2; });
+
+        auto count = 0;
+        auto sum   = 0;
+        map.read_all([&](const int& k, const int& v) {
+            ++count;
+            sum += v - 2 * k;
+        });
+        ut::expect(count == 100);
+        ut::expect(sum == 0);
+    };
+
+    "Concurrent inserts"_test = [] {
+        auto map     = spp::SyncShardedMap<int, int>{};
+        auto threads = std::vector<std::jthread>{};
+        for (auto t = 0; t < 4; ++t) {
+            threads.emplace_back([&, t] {
+                for (auto i = 0; i < 5'000; ++i) {
+                    map.try_emplace(t * 5'000 + i, t);
+                    std::ignore = map.write(i, [](int& v) { ++v; });
+                }
+            });
+        }
+        threads.clear();
+
+        ut::expect(map.size() == 20'000u);
+    };
+}
@@ -0,0 +1,125 @@
+#include <sync_cpp/sync.hpp>
+#include <sync_cpp/sync_opt.hpp>
+#include <sync_cpp/sync_slab.hpp>
+#include <sync_cpp/sync_smart_ptr.hpp>
+
+#include <boost/ut.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct Entry
+{
+    long m_value = 0;
+};
+
+int main()
+{
+    namespace ut = boost::ut;
+    using namespace ut::literals;
+
+    "Handles find their object until it is erased"_test = [] {
+        auto slab = spp::SyncSlab<spp::Sync<Entry, std::shared_mutex>>{};
+
+        auto first  = slab.emplace(1);
+        auto second = slab.emplace(2);
+        ut::expect(slab.size() == 2);
+        ut::expect(slab[second].read([](const Entry& e) { return e.m_value; }) == 2);
+
+        ut::expect(slab.erase(first));
+        ut::expect(not slab.erase(first));
+        ut::expect(slab.find(first) == nullptr);
+        ut::expect(slab.find(second) != nullptr);
+        ut::expect(slab.size() == 1);
+
+        // the slot is recycled, the old handle stays stale
+        auto third = slab.emplace(3);
+        ut::expect(third.m_index == first.m_index);
+        ut::expect(third != first);
+        ut::expect(slab.find(first) == nullptr);
+        ut::expect(slab.find(third)->read([](const Entry& e) { return e.m_value; }) == 3);
+        ut::expect(slab.handle_of(slab[third]) == third);
+    };
+
+    "Addresses are stable and iteration follows memory order"_test = [] {
+        auto slab     = spp::SyncSlab<spp::Sync<Entry>, 4>{};
+        auto handles  = std::vector<decltype(slab)::Handle>{};
+        auto pointers = std::vector<const void*>{};
+
+        for (auto i = 0; i < 100; ++i) {
+            handles.push_back(slab.emplace(i));
+            pointers.push_back(&slab[handles.back()]);
+        }
+        for (auto i = 0; i < 100; i += 3) {
+            slab.erase(handles[i]);
+        }
+
+        auto visited = std::vector<long>{};
+        for (auto& entry : slab) {
+            visited.push_back(entry.read([](const Entry& e) { return e.m_value; }));
+        }
+        ut::expect(visited.size() == slab.size());
+        ut::expect(std::ranges::is_sorted(visited));
+        ut::expect(visited.front() == 1 and visited.back() == 98);
+
+        for (auto i = 1; i < 100; i += 3) {
+            ut::expect(&slab[handles[i]] == pointers[i]);
+        }
+    };
+
+    "Any Sync derivative can be stored"_test = [] {
+        auto optionals = spp::SyncSlab<spp::SyncOpt<std::string>>{};
+        auto some      = optionals.emplace("value");
+        auto none      = optionals.emplace(std::nullopt);
+        ut::expect(optionals[some].has_value());
+        ut::expect(not optionals[none].has_value());
+
+        auto pointers = spp::SyncSlab<spp::SyncUnique<Entry>>{};
+        auto handle   = pointers.emplace(std::make_unique<Entry>(7));
+        ut::expect(pointers[handle].read([](const std::unique_ptr<Entry>& e) { return e->m_value; }) == 7);
+        ut::expect(pointers.erase(handle));
+        ut::expect(pointers.empty());
+    };
+
+    "Concurrent emplace and erase"_test = [] {
+        constexpr auto threads    = 4;
+        constexpr auto iterations = 10'000;
+
+        auto slab   = spp::SyncSlab<spp::Sync<Entry>, 16>{};
+        auto failed = std::atomic<int>{ 0 };
+        {
+            auto workers = std::vector<std::jthread>{};
+            for (auto t = 0; t < threads; ++t) {
+                workers.emplace_back([&] {
+                    auto kept = std::vector<decltype(slab)::Handle>{};
+                    for (auto i = 0; i < iterations; ++i) {
+                        auto handle = slab.emplace(1);
+                        slab[handle].write([](Entry& e) { ++e.m_value; });
+                        if (i % 2 == 0) {
+                            failed += slab.erase(handle) ? 0 : 1;
+                        } else {
+                            kept.push_back(handle);
+                        }
+                    }
+                    for (auto handle : kept) {
+                        failed += slab.find(handle) != nullptr ? 0 : 1;
+                    }
+                });
+            }
+        }
+
+        auto total = 0l;
+        for (const auto& entry : slab) {
+            total += entry.read([](const Entry& e) { return e.m_value; });
+        }
+        ut::expect(failed.load() == 0);
+        ut::expect(slab.size() == threads * iterations / 2);
+        ut::expect(total == 2l * threads * iterations / 2);
+    };
+}
@@ -0,0 +1,149 @@
+#include <sync_cpp/sync_strand.hpp>
+#include <sync_cpp/thread_pool.hpp>
+
+#include <boost/ut.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <latch>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+struct Counter
+{
+    long m_value = 0;
+};
+
+int main()
+{
+    namespace ut = boost::ut;
+    using namespace ut::literals;
+
+    "The pool runs every task, including the ones posted by its workers"_test = [] {
+        constexpr auto outer = 16;
+        constexpr auto inner = 500;
+
+        auto count = std::atomic<int>{ 0 };
+        {
+            auto pool = spp::ThreadPool{ 4 };
+            ut::expect(pool.size() == 4);
+
+            for (auto i = 0; i < outer; ++i) {
+                pool.post([&] {
+                    for (auto j = 0; j < inner; ++j) {
+                        pool.post([&] { count.fetch_add(1, std::memory_order_relaxed); });
+                    }
+                });
+            }
+        }    // the destructor runs what is still queued
+        ut::expect(count.load() == outer * inner);
+    };
+
+    "Idle workers steal from a busy one"_test = [] {
+        auto pool = spp::ThreadPool{ 2 };
+        auto both = std::latch{ 2 };
+
+        // both tasks land in the queue of the first worker, they only meet if the other one steals
+        pool.post([&] {
+            pool.post([&] { both.arrive_and_wait(); });
+            both.arrive_and_wait();
+        });
+        both.wait();
+    };
+
+    "Operations run one at a time, in order"_test = [] {
+        constexpr auto threads    = 4;
+        constexpr auto iterations = 2'000;
+
+        auto pool    = spp::ThreadPool{ 4 };
+        auto counter = spp::SyncStrand<Counter>{ pool };
+        auto running = std::atomic<int>{ 0 };
+        auto overlap = std::atomic<bool>{ false };
+        {
+            auto producers = std::vector<std::jthread>{};
+            for (auto t = 0; t < threads; ++t) {
+                producers.emplace_back([&] {
+                    for (auto i = 0; i < iterations; ++i) {
+                        std::ignore = counter.write_async([&](Counter& c) {
+                            overlap = overlap or running.fetch_add(1) != 0;
+                            ++c.m_value;
+                            running.fetch_sub(1);
+                        });
+                    }
+                });
+            }
+        }
+
+        auto order = std::vector<int>{};
+        for (auto i = 0; i < 100; ++i) {
+            counter.write_async([i, &order](Counter&) { order.push_back(i); }, [] {});
+        }
+        counter.wait();
+
+        ut::expect(not overlap.load());
+        auto total = counter.read_async([](const Counter& c) { return c.m_value; });
+        ut::expect(total.get() == threads * iterations);
+        ut::expect(std::ranges::is_sorted(order) and order.size() == 100);
+    };
+
+    "Results come through a future or a callback"_test = [] {
+        auto pool = spp::ThreadPool{ 2 };
+        auto text = spp::SyncStrand<std::string>{ pool, "hello" };
+
+        auto size = text.write_async([](std::string& s) {
+            s += " world";
+            return s.size();
+        });
+        ut::expect(size.get() == 11);
+
+        auto copy = std::promise<std::string>{};
+        text.read_async([](const std::string& s) { return s; }, [&](std::string s) { copy.set_value(s); });
+        ut::expect(copy.get_future().get() == "hello world");
+
+        auto failed = text.write_async([](std::string&) -> int { throw std::runtime_error{ "failed" }; });
+        ut::expect(ut::throws([&] { std::ignore = failed.get(); }));
+        ut::expect(text.read_async([](const std::string& s) { return s.size(); }).get() == 11);
+    };
+
+    "A busy strand lets the other tasks of the pool run"_test = [] {
+        auto pool    = spp::ThreadPool{ 1 };
+        auto counter = spp::SyncStrand<Counter>{ pool };
+        auto stop    = std::atomic<bool>{ false };
+        auto started = std::latch{ 1 };
+        auto ran     = std::promise<void>{};
+
+        // every operation queues the next one, so the strand never runs out of work by itself
+        auto next = std::function<void()>{};
+        next      = [&] {
+            if (not stop.load()) {
+                counter.write_async([](Counter& c) { ++c.m_value; }, [&] { next(); });
+            }
+        };
+        counter.write_async([&](Counter&) { started.count_down(); }, [&] { next(); });
+
+        started.wait();
+        pool.post([&] { ran.set_value(); });    // queued while the strand runs
+
+        auto status = ran.get_future().wait_for(std::chrono::seconds{ 2 });
+        stop = true;
+        counter.wait();
+        ut::expect(status == std::future_status::ready);
+    };
+
+    "Move-only functions and the global pool"_test = [] {
+        auto value = spp::SyncStrand<Counter>{};
+        auto boxed = std::make_unique<long>(5);
+
+        auto result = value.write_async([boxed = std::move(boxed)](Counter& c) {
+            return c.m_value += *boxed;
+        });
+        ut::expect(result.get() == 5);
+    };
+}
@@ -0,0 +1,143 @@
+#include <sync_cpp/sync.hpp>
+#include <sync_cpp/group.hpp>
+#include <sync_cpp/sync_opt.hpp>
+#include <sync_cpp/mutex/striped.hpp>
+
+#include <boost/ut.hpp>
+
+#include <array>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+struct Counter
+{
+    long m_value = 0;
+};
+
+// find two distinct elements that map to the same stripe
+template <typename Array>
+auto colliding(Array& array)
+{
+    using Element = typename Array::value_type;
+    for (auto i = 0u; i < array.size(); ++i) {
+        for (auto j = i + 1; j < array.size(); ++j) {
+            if (&array[i].mutex() == &array[j].mutex()) {
+                return std::pair<Element*, Element*>{ &array[i], &array[j] };
+            }
+        }
+    }
+    return std::pair<Element*, Element*>{ nullptr, nullptr };
+}
+
+int main()
+{
+    namespace ut = boost::ut;
+    using namespace ut::literals;
+
+    using Table       = spp::Striped<std::mutex, 2>;
+    using SharedTable = spp::Striped<std::shared_mutex, 2>;
+
+    "Sync holds no mutex"_test = [] {
+        ut::expect(sizeof(spp::Sync<Counter, spp::Striped<>>) == sizeof(Counter));
+        ut::expect(sizeof(spp::SyncOpt<Counter, spp::Striped<>>) == sizeof(std::optional<Counter>));
+        ut::expect(spp::concepts::SyncMutex<spp::Striped<>>);
+
+        auto sync = spp::Sync<Counter, spp::Striped<>>{};
+        ut::expect(&sync.mutex() == &spp::Striped<>::stripe_for(&sync));
+    };
+
+    "Objects are spread over the stripes"_test = [] {
+        auto syncs   = std::array<spp::Sync<Counter, spp::Striped<std::mutex, 64>>, 256>{};
+        auto touched = std::array<bool, 64>{};
+        for (const auto& sync : syncs) {
+            touched[spp::Striped<std::mutex, 64>::stripe_index(&sync)] = true;
+        }
+        auto count = 0;
+        for (auto hit : touched) {
+            count += hit;
+        }
+        ut::expect(count > 32);
+    };
+
+    "Concurrent writes on objects sharing stripes"_test = [] {
+        auto syncs   = std::array<spp::Sync<Counter, Table>, 8>{};
+        auto threads = std::vector<std::jthread>{};
+        for (auto t = 0; t < 4; ++t) {
+            threads.emplace_back([&] {
+                for (auto i = 0; i < 10'000; ++i) {
+                    syncs[i % syncs.size()].write([](Counter& c) { ++c.m_value; });
+                }
+            });
+        }
+        threads.clear();
+
+        auto sum = 0l;
+        for (const auto& sync : syncs) {
+            sum += sync.get(&Counter::m_value);
+        }
+        ut::expect(sum == 40'000);
+    };
+
+    "Group and swap on a shared stripe don't self-deadlock"_test = [] {
+        auto syncs  = std::array<spp::Sync<Counter, Table>, 8>{};
+        auto [a, b] = colliding(syncs);
+        ut::expect(a != nullptr and b != nullptr);
+
+        a->write([](Counter& c) { c.m_value = 1; });
+        b->write([](Counter& c) { c.m_value = 2; });
+
+        auto sum = spp::group(*a, *b).write([](Counter& x, Counter& y) {
+            return ++x.m_value + ++y.m_value;
+        });
+        ut::expect(sum == 5);
+
+        a->swap(*b);
+        ut::expect(a->get(&Counter::m_value) == 3);
+        ut::expect(b->get(&Counter::m_value) == 2);
+        a->swap(*a);
+    };
+
+    "Mixed modes on a shared stripe take the strongest one"_test = [] {
+        auto syncs  = std::array<spp::Sync<Counter, SharedTable>, 8>{};
+        auto [a, b] = colliding(syncs);
+        ut::expect(a != nullptr and b != nullptr);
+
+        const auto& ca = *a;
+        spp::group(ca, *b).lock([&](const Counter&, Counter& y) {
+            ut::expect(not b->mutex().try_lock_shared());
+            y.m_value = 42;
+        });
+        ut::expect(b->get(&Counter::m_value) == 42);
+
+        auto read = spp::group(ca, *b).read([](const Counter& x, const Counter& y) {
+            return x.m_value + y.m_value;
+        });
+        ut::expect(read == 42);
+    };
+
+    "Groups in opposite order don't deadlock"_test = [] {
+        auto syncs   = std::array<spp::Sync<Counter, spp::Striped<std::mutex, 4>>, 8>{};
+        auto threads = std::vector<std::jthread>{};
+        for (auto t = 0; t < 4; ++t) {
+            threads.emplace_back([&, t] {
+                for (auto i = 0; i < 10'000; ++i) {
+                    auto& x = syncs[(i + t) % syncs.size()];
+                    auto& y = syncs[(i + t + 3) % syncs.size()];
+                    auto  g = t % 2 == 0 ? spp::group(x, y) : spp::group(y, x);
+                    g.write([](Counter& l, Counter& r) { ++l.m_value, ++r.m_value; });
+                }
+            });
+        }
+        threads.clear();
+
+        auto sum = 0l;
+        for (const auto& sync : syncs) {
+            sum += sync.get(&Counter::m_value);
+        }
+        ut::expect(sum == 80'000);
+    };
+}
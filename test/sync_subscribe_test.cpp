@@ -0,0 +1,190 @@
+#include <sync_cpp/sync.hpp>
+#include <sync_cpp/group.hpp>
+#include <sync_cpp/subscription.hpp>
+
+#include <boost/ut.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <latch>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+struct Counter
+{
+    long m_value = 0;
+};
+
+// wait (a bounded time) for a condition set by the notifier thread
+bool eventually(auto&& condition)
+{
+    auto deadline = std::chrono::steady_clock::now() + 5s;
+    while (not condition()) {
+        if (std::chrono::steady_clock::now() >= deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(100us);
+    }
+    return true;
+}
+
+int main()
+{
+    namespace ut = boost::ut;
+    using namespace ut::literals;
+
+    "The current value is delivered, then the changes"_test = [] {
+        auto sync = spp::Sync<Counter, std::shared_mutex>{ Counter{ 1 } };
+        auto seen = std::atomic<long>{ 0 };
+
+        auto subscription = sync.subscribe([&](const Counter& c) { seen = c.m_value; });
+        ut::expect(eventually([&] { return seen == 1; }));
+
+        sync.write([](Counter& c) { c.m_value = 2; });
+        ut::expect(eventually([&] { return seen == 2; }));
+
+        spp::group(sync).write([](Counter& c) { c.m_value = 3; });
+        ut::expect(eventually([&] { return seen == 3; }));
+    };
+
+    "A projection makes a cheap snapshot"_test = [] {
+        auto sync = spp::Sync<std::vector<std::string>>{};
+        auto size = std::atomic<std::size_t>{ 99 };
+
+        auto subscription = sync.subscribe(
+            [](const std::vector<std::string>& v) { return v.size(); },
+            [&](std::size_t s) { size = s; }
+        );
+        ut::expect(eventually([&] { return size == 0; }));
+
+        sync.write([](auto& v) { v.emplace_back("one"); });
+        ut::expect(eventually([&] { return size == 1; }));
+    };
+
+    "A burst of writes makes few notifications, of the latest value"_test = [] {
+        constexpr auto writes = 10'000;
+
+        auto sync  = spp::Sync<Counter>{};
+        auto gate  = spp::Sync<Counter>{};
+        auto held  = std::latch{ 1 };
+        auto go    = std::latch{ 1 };
+        auto calls = std::atomic<int>{ 0 };
+        auto last  = std::atomic<long>{ -1 };
+
+        // a slow subscriber holds the notifier thread while the burst happens
+        auto blocker = gate.subscribe([&](const Counter&) {
+            held.count_down();
+            go.wait();
+        });
+        held.wait();
+
+        auto subscription = sync.subscribe([&](const Counter& c) {
+            ++calls;
+            last = c.m_value;
+        });
+
+        auto start = std::chrono::steady_clock::now();
+        for (auto i = 1; i <= writes; ++i) {
+            sync.write([&](Counter& c) { c.m_value = i; });
+        }
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        go.count_down();
+
+        ut::expect(eventually([&] { return last == writes; }));
+        ut::expect(calls.load() <= 2);
+        ut::expect(elapsed < 1s);    // the writer was not held up by the blocked notifier
+    };
+
+    "A write that didn't get the lock notifies nobody"_test = [] {
+        auto sync  = spp::Sync<Counter, std::timed_mutex>{};
+        auto calls = std::atomic<int>{ 0 };
+
+        auto subscription = sync.subscribe([&](const Counter&) { ++calls; });
+        ut::expect(eventually([&] { return calls == 1; }));
+
+        sync.mutex().lock();    // held without writing
+        std::jthread{ [&] {
+            ut::expect(not sync.try_write([](Counter& c) { c.m_value = 1; }));
+            ut::expect(not sync.write_for(1ms, [](Counter& c) { c.m_value = 2; }));
+        } }.join();
+        sync.mutex().unlock();
+
+        auto other = std::atomic<bool>{ false };
+        auto probe = sync.subscribe([&](const Counter&) { other = true; });
+        ut::expect(eventually([&] { return other.load(); }));    // the queue was drained past the attempts
+        ut::expect(calls.load() == 1);
+    };
+
+    "Unsubscribing stops the notifications"_test = [] {
+        auto sync  = spp::Sync<Counter>{};
+        auto calls = std::atomic<int>{ 0 };
+
+        auto subscription = sync.subscribe([&](const Counter&) { ++calls; });
+        ut::expect(eventually([&] { return calls == 1; }));
+        ut::expect(subscription.active());
+
+        subscription.unsubscribe();
+        ut::expect(not subscription.active());
+        sync.write([](Counter& c) { c.m_value = 1; });
+
+        auto other = std::atomic<bool>{ false };
+        auto probe = sync.subscribe([&](const Counter&) { other = true; });
+        ut::expect(eventually([&] { return other.load(); }));    // the queue was drained past the write
+        ut::expect(calls.load() == 1);
+    };
+
+    "A callback may unsubscribe itself"_test = [] {
+        auto sync         = spp::Sync<Counter>{};
+        auto calls        = std::atomic<int>{ 0 };
+        auto done         = std::atomic<bool>{ false };
+        auto subscription = spp::Subscription{};
+
+        subscription = sync.subscribe([&](const Counter& c) {
+            ++calls;
+            if (c.m_value == 1) {
+                subscription.unsubscribe();
+                done = true;
+            }
+        });
+        ut::expect(eventually([&] { return calls == 1; }));
+
+        sync.write([](Counter& c) { c.m_value = 1; });
+        ut::expect(eventually([&] { return done.load(); }));
+        ut::expect(not subscription.active());
+        sync.write([](Counter& c) { c.m_value = 2; });
+
+        auto other = std::atomic<bool>{ false };
+        auto probe = sync.subscribe([&](const Counter&) { other = true; });
+        ut::expect(eventually([&] { return other.load(); }));
+        ut::expect(calls.load() == 2);
+    };
+
+    "Concurrent writers and subscribers"_test = [] {
+        constexpr auto threads    = 4;
+        constexpr auto iterations = 10'000;
+
+        auto sync  = spp::Sync<Counter>{};
+        auto total = std::atomic<long>{ 0 };
+        {
+            auto subscriptions = std::vector<spp::Subscription>{};
+            for (auto s = 0; s < 4; ++s) {
+                subscriptions.push_back(sync.subscribe([&](const Counter& c) { total = c.m_value; }));
+            }
+
+            auto workers = std::vector<std::jthread>{};
+            for (auto t = 0; t < threads; ++t) {
+                workers.emplace_back([&] {
+                    for (auto i = 0; i < iterations; ++i) {
+                        sync.write([](Counter& c) { ++c.m_value; });
+                    }
+                });
+            }
+            workers.clear();
+            ut::expect(eventually([&] { return total == threads * iterations; }));
+        }
+    };
+}
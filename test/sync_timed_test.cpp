@@ -0,0 +1,144 @@
+#include <sync_cpp/sync.hpp>
+#include <sync_cpp/group.hpp>
+#include <sync_cpp/sync_opt.hpp>
+#include <sync_cpp/mutex/spin_lock.hpp>
+
+#include <boost/ut.hpp>
+
+#include <chrono>
+#include <latch>
+#include <mutex>
+#include <shared_mutex>
+#include <stop_token>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+struct Counter
+{
+    long m_value = 0;
+};
+
+// hold the write lock of a Sync from another thread until released
+template <typename S>
+class Holder
+{
+public:
+    Holder(S& sync)
+        : m_thread{ [&] { sync.write([&](auto&) { m_held.count_down(), m_release.wait(); }); } }
+    {
+        m_held.wait();
+    }
+
+    ~Holder() { release(); }
+
+    void release()
+    {
+        if (m_thread.joinable()) {
+            m_release.count_down();
+            m_thread.join();
+        }
+    }
+
+private:
+    std::latch   m_held{ 1 };
+    std::latch   m_release{ 1 };
+    std::jthread m_thread;
+};
+
+int main()
+{
+    namespace ut = boost::ut;
+    using namespace ut::literals;
+
+    "try_read and try_write don't wait"_test = [] {
+        auto sync = spp::Sync<Counter, std::shared_mutex>{ Counter{ 1 } };
+        ut::expect(sync.try_read([](const Counter& c) { return c.m_value; }) == 1);
+        ut::expect(sync.try_write([](Counter& c) { c.m_value = 2; }));
+
+        auto holder = Holder{ sync };
+        ut::expect(not sync.try_read([](const Counter& c) { return c.m_value; }).has_value());
+        ut::expect(not sync.try_write([](Counter& c) { c.m_value = 3; }));
+
+        holder.release();
+        ut::expect(sync.try_read([](const Counter& c) { return c.m_value; }) == 2);
+    };
+
+    "Timed access gives up at the deadline"_test = [] {
+        auto timed = []<typename M>(std::type_identity<M>) {
+            auto sync   = spp::Sync<Counter, M>{};
+            auto holder = Holder{ sync };
+
+            auto start = std::chrono::steady_clock::now();
+            ut::expect(not sync.read_for(20ms, [](const Counter& c) { return c.m_value; }).has_value());
+            ut::expect(std::chrono::steady_clock::now() - start >= 20ms);
+
+            auto deadline = std::chrono::system_clock::now() + 10ms;
+            ut::expect(not sync.write_until(deadline, [](Counter& c) { ++c.m_value; }));
+
+            holder.release();
+            ut::expect(sync.write_for(20ms, [](Counter& c) { return ++c.m_value; }) == 1);
+        };
+
+        timed(std::type_identity<std::timed_mutex>{});           // waits on the mutex
+        timed(std::type_identity<std::shared_timed_mutex>{});    // waits on the mutex, shared reads
+        timed(std::type_identity<spp::SpinLock<>>{});            // polled
+    };
+
+    "A stop request abandons the wait"_test = [] {
+        auto sync   = spp::Sync<Counter, std::timed_mutex>{};
+        auto holder = Holder{ sync };
+        auto source = std::stop_source{};
+
+        auto stopper = std::jthread{ [&] {
+            std::this_thread::sleep_for(10ms);
+            source.request_stop();
+        } };
+        ut::expect(not sync.write(source.get_token(), [](Counter& c) { ++c.m_value; }));
+
+        holder.release();
+        ut::expect(sync.read(std::stop_token{}, [](const Counter& c) { return c.m_value; }) == 0);
+    };
+
+    "SyncContainer mirrors the bounded accesses"_test = [] {
+        auto opt    = spp::SyncOpt<Counter>{ Counter{ 5 } };
+        auto source = std::stop_source{};
+        ut::expect(opt.try_read_value([](const Counter& c) { return c.m_value; }) == 5);
+        ut::expect(opt.write_value_for(1ms, [](Counter& c) { return ++c.m_value; }) == 6);
+        ut::expect(opt.read_value(source.get_token(), [](const Counter& c) { return c.m_value; }) == 6);
+
+        auto holder = Holder{ opt };
+        ut::expect(not opt.try_write_value([](Counter& c) { ++c.m_value; }));
+        ut::expect(not opt.read_value_until(std::chrono::steady_clock::now() + 1ms, [](const Counter&) {}));
+    };
+
+    "Group acquires every lock or none"_test = [] {
+        auto a = spp::Sync<Counter>{};
+        auto b = spp::Sync<Counter, std::timed_mutex>{};
+
+        auto sum = spp::group(a, b).try_write([](Counter& x, Counter& y) {
+            return ++x.m_value + ++y.m_value;
+        });
+        ut::expect(sum == 2);
+
+        {
+            auto holder = Holder{ b };
+            ut::expect(not spp::group(a, b).try_write([](Counter&, Counter&) {}));
+            ut::expect(not spp::group(a, b).write_for(10ms, [](Counter&, Counter&) {}));
+
+            const auto& cb = b;
+            ut::expect(not spp::group(a, cb).lock_for(10ms, [](Counter&, const Counter&) {}));
+
+            // a is not left locked behind
+            ut::expect(a.try_write([](Counter& c) { ++c.m_value; }));
+
+            auto source = std::stop_source{};
+            source.request_stop();
+            ut::expect(not spp::group(a, b).read(source.get_token(), [](const Counter&, const Counter&) {}));
+        }
+
+        ut::expect(spp::group(a, b).read_for(10ms, [](const Counter& x, const Counter& y) {
+            return x.m_value + y.m_value;
+        }) == 3);
+    };
+}
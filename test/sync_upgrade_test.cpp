@@ -0,0 +1,121 @@
+#include <sync_cpp/sync.hpp>
+#include <sync_cpp/mutex/parking_mutex.hpp>
+
+#include <boost/ut.hpp>
+
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+using Cache = std::map<int, std::string>;
+
+struct Counter
+{
+    long m_value = 0;
+};
+
+// whether another thread could take a shared (or an exclusive) lock of the object right now
+bool readable(auto& sync)
+{
+    auto result = false;
+    auto reader = std::thread{ [&] { result = sync.try_read([](const auto&) {}); } };
+    reader.join();
+    return result;
+}
+
+bool writable(auto& sync)
+{
+    auto result = false;
+    auto writer = std::thread{ [&] { result = sync.try_write([](auto&) {}); } };
+    writer.join();
+    return result;
+}
+
+int main()
+{
+    namespace ut = boost::ut;
+    using namespace ut::literals;
+
+    auto insert_missing = []<typename M>(std::type_identity<M>) {
+        auto cache = spp::Sync<Cache, M>{};
+        auto miss  = [](const Cache& c) { return not c.contains(42); };
+
+        auto inserted = cache.update(miss, [](Cache& c) { return c.emplace(42, "answer").second; });
+        ut::expect(inserted == true);
+
+        auto again = cache.update(miss, [](Cache& c) { return c.emplace(42, "other").second; });
+        ut::expect(not again.has_value());
+
+        ut::expect(cache.update([](const Cache& c) { return c.size() == 1; }, [](Cache& c) { c.clear(); }));
+        ut::expect(cache.read([](const Cache& c) { return c.empty(); }));
+    };
+
+    "Update only modifies when the condition holds"_test = [&] {
+        insert_missing(std::type_identity<std::mutex>{});
+        insert_missing(std::type_identity<std::shared_mutex>{});
+        insert_missing(std::type_identity<spp::ParkingUpgradeMutex>{});
+    };
+
+    "Readers proceed while the condition is checked"_test = [] {
+        auto check = []<typename M>(std::type_identity<M>, bool shared) {
+            auto cache = spp::Sync<Cache, M>{};
+            auto seen  = cache.update([&](const Cache&) { return readable(cache); }, [](Cache&) {});
+            ut::expect(seen == shared);
+        };
+
+        check(std::type_identity<std::mutex>{}, false);
+        check(std::type_identity<spp::ParkingUpgradeMutex>{}, true);
+    };
+
+    "An upgrade lets no writer in between"_test = [] {
+        constexpr auto threads    = 4;
+        constexpr auto iterations = 20'000;
+
+        // every thread bumps the value while it's below the limit, no update may overshoot it
+        auto counter = spp::Sync<Counter, spp::ParkingUpgradeMutex>{};
+        auto limit   = threads * iterations / 2;
+        {
+            auto workers = std::vector<std::jthread>{};
+            for (auto t = 0; t < threads; ++t) {
+                workers.emplace_back([&] {
+                    for (auto i = 0; i < iterations; ++i) {
+                        std::ignore = counter.update(
+                            [&](const Counter& c) { return c.m_value < limit; },
+                            [](Counter& c) { ++c.m_value; }
+                        );
+                        std::ignore = counter.read([](const Counter& c) { return c.m_value; });
+                    }
+                });
+            }
+        }
+        ut::expect(counter.read([](const Counter& c) { return c.m_value; }) == limit);
+    };
+
+    "Write then read downgrades a downgradable mutex"_test = [] {
+        auto parked = spp::Sync<Cache, spp::ParkingUpgradeMutex>{};
+        auto result = parked.write_then_read(
+            [](Cache& c) { c.emplace(1, "one"); },
+            [&](const Cache& c) {
+                ut::expect(readable(parked));
+                ut::expect(not writable(parked));
+                return c.at(1);
+            }
+        );
+        ut::expect(result == "one");
+
+        auto standard = spp::Sync<Cache, std::shared_mutex>{};
+        auto size     = standard.write_then_read(
+            [](Cache& c) { c.emplace(1, "one"); },
+            [&](const Cache& c) {
+                ut::expect(not readable(standard));
+                return c.size();
+            }
+        );
+        ut::expect(size == 1);
+    };
+}
@@ -0,0 +1,153 @@
+#include <sync_cpp/sync.hpp>
+#include <sync_cpp/dynamic_group.hpp>
+#include <sync_cpp/group.hpp>
+#include <sync_cpp/mutex/parking_mutex.hpp>
+
+#include <boost/ut.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+struct Counter
+{
+    void increment() { ++m_value; }
+
+    long m_value = 0;
+};
+
+int main()
+{
+    namespace ut = boost::ut;
+    using namespace ut::literals;
+
+    "A condition that already holds doesn't wait"_test = [] {
+        auto sync = spp::Sync<Counter, std::shared_mutex>{ Counter{ 3 } };
+
+        auto value = sync.wait_read([](const Counter& c) { return c.m_value > 0; }, [](auto& c) {
+            return c.m_value;
+        });
+        ut::expect(value == 3);
+
+        sync.wait_write([](const Counter& c) { return c.m_value == 3; }, [](Counter& c) { c.m_value = 4; });
+        ut::expect(sync.read([](const Counter& c) { return c.m_value; }) == 4);
+    };
+
+    "A waiter wakes up once a write makes the condition hold"_test = [] {
+        auto sync   = spp::Sync<Counter, std::shared_mutex>{};
+        auto result = 0l;
+        {
+            auto waiter = std::jthread{ [&] {
+                result = sync.wait_read([](const Counter& c) { return c.m_value >= 10; }, [](auto& c) {
+                    return c.m_value;
+                });
+            } };
+            for (auto i = 0; i < 10; ++i) {
+                std::this_thread::sleep_for(1ms);
+                sync.write([](Counter& c) { ++c.m_value; });
+            }
+        }
+        ut::expect(result == 10);
+    };
+
+    "Timed waits give up"_test = [] {
+        auto sync = spp::Sync<Counter>{};
+
+        auto start  = std::chrono::steady_clock::now();
+        auto result = sync.wait_read_for(20ms, [](const Counter& c) { return c.m_value > 0; }, [](auto& c) {
+            return c.m_value;
+        });
+        ut::expect(not result.has_value());
+        ut::expect(std::chrono::steady_clock::now() - start >= 20ms);
+
+        auto deadline = std::chrono::system_clock::now() + 10ms;
+        auto positive = [](const Counter& c) { return c.m_value > 0; };
+        ut::expect(not sync.wait_write_until(deadline, positive, [](auto&) {}));
+
+        sync.write([](Counter& c) { c.m_value = 1; });
+        ut::expect(sync.wait_write_for(1s, positive, [](auto&) {}));
+    };
+
+    "Writes through every path wake the waiters"_test = [] {
+        auto a = spp::Sync<Counter, spp::ParkingMutex>{};
+        auto b = spp::Sync<Counter, spp::ParkingMutex>{};
+
+        auto wait_for = [&](long target, auto&& write) {
+            auto done   = std::atomic<bool>{ false };
+            auto waiter = std::jthread{ [&] {
+                auto reached = [&](const Counter& c) { return c.m_value == target; };
+                done         = a.wait_read_for(5s, reached, [](auto&) {});
+            } };
+            std::this_thread::sleep_for(5ms);
+            write();
+            waiter.join();
+            return done.load();
+        };
+
+        ut::expect(wait_for(1, [&] { a.write([](Counter& c) { c.m_value = 1; }); }));
+        ut::expect(wait_for(2, [&] { a.write(&Counter::increment); }));
+        ut::expect(wait_for(3, [&] {
+            std::ignore = a.update([](const Counter&) { return true; }, [](Counter& c) { c.m_value = 3; });
+        }));
+        ut::expect(wait_for(4, [&] { std::ignore = a.try_write([](Counter& c) { c.m_value = 4; }); }));
+        ut::expect(wait_for(5, [&] { std::ignore = a.write_for(1s, [](Counter& c) { c.m_value = 5; }); }));
+        ut::expect(wait_for(6, [&] { spp::group(a, b).write([](Counter& x, Counter&) { x.m_value = 6; }); }));
+        ut::expect(wait_for(7, [&] {
+            auto syncs = std::vector{ &a, &b };
+            spp::group(syncs).write([](auto values) { values[0].get().m_value = 7; });
+        }));
+        ut::expect(wait_for(8, [&] {
+            b.write([](Counter& c) { c.m_value = 8; });
+            a.swap(b);
+        }));
+    };
+
+    "Producers and consumers"_test = [] {
+        constexpr auto producers = 2;
+        constexpr auto consumers = 2;
+        constexpr auto items     = 5'000;
+
+        auto queue    = spp::Sync<std::deque<int>, std::mutex>{};
+        auto consumed = std::atomic<long>{ 0 };
+        auto sum      = std::atomic<long>{ 0 };
+        {
+            auto threads = std::vector<std::jthread>{};
+            for (auto p = 0; p < producers; ++p) {
+                threads.emplace_back([&] {
+                    for (auto i = 1; i <= items; ++i) {
+                        // bounded: wait for room before pushing
+                        queue.wait_write([](const auto& q) { return q.size() < 16; }, [&](auto& q) {
+                            q.push_back(i);
+                        });
+                    }
+                });
+            }
+            for (auto c = 0; c < consumers; ++c) {
+                threads.emplace_back([&] {
+                    for (auto i = 0; i < items * producers / consumers; ++i) {
+                        auto pop = [](auto& q) {
+                            auto front = q.front();
+                            q.pop_front();
+                            return front;
+                        };
+                        auto value = queue.wait_write([](const auto& q) { return not q.empty(); }, pop);
+                        sum += value;
+                        ++consumed;
+                    }
+                });
+            }
+        }
+        ut::expect(consumed.load() == long{ producers * items });
+        ut::expect(sum.load() == long{ producers } * items * (items + 1) / 2);
+    };
+
+    "Waiting adds nothing to the object"_test = [] {
+        ut::expect(sizeof(spp::Sync<Counter, spp::ParkingMutex>) == 2 * sizeof(Counter));
+    };
+}
@@ -0,0 +1,145 @@
+#ifndef SYNC_CPP_TRACE
+#    define SYNC_CPP_TRACE
+#endif
+
+#include <sync_cpp/sync.hpp>
+#include <sync_cpp/group.hpp>
+#include <sync_cpp/sync_opt.hpp>
+#include <sync_cpp/trace.hpp>
+
+#include <boost/ut.hpp>
+
+#include <algorithm>
+#include <ranges>
+#include <shared_mutex>
+#include <source_location>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+struct Counter
+{
+    long m_value = 0;
+};
+
+// the events recorded by the calling thread
+std::vector<spp::trace::Event> local_events()
+{
+    auto threads = spp::trace::snapshot();
+    auto thread  = spp::detail::thread_index();
+    auto local   = std::ranges::find(threads, thread, &spp::trace::ThreadEvents::m_thread);
+    return local == threads.end() ? std::vector<spp::trace::Event>{} : local->m_events;
+}
+
+int main()
+{
+    namespace ut = boost::ut;
+    using namespace ut::literals;
+    using spp::trace::Phase;
+
+    static_assert(spp::trace::enabled);
+
+    "Accesses record wait, acquire and release at the call site"_test = [] {
+        spp::trace::clear();
+
+        auto sync = spp::Sync<Counter, std::shared_mutex>{};
+        auto line = std::source_location::current().line() + 1;
+        sync.write([](Counter& c) { ++c.m_value; });
+        std::ignore = sync.read([](const Counter& c) { return c.m_value; });
+
+        auto events = local_events();
+        ut::expect(events.size() == 6) << events.size();
+        if (events.size() != 6) {
+            return;
+        }
+
+        auto phases = { Phase::Wait, Phase::Acquire, Phase::Release };
+        ut::expect(std::ranges::equal(std::views::take(events, 3), phases, {}, &spp::trace::Event::m_phase));
+        ut::expect(std::ranges::equal(std::views::drop(events, 3), phases, {}, &spp::trace::Event::m_phase));
+
+        ut::expect(events[0].m_line == line);
+        ut::expect(events[3].m_line == line + 1);
+        ut::expect(std::string_view{ events[0].m_file }.ends_with("trace_test.cpp"));
+        ut::expect(events[0].m_mutex == &sync.mutex());
+        ut::expect(not events[0].m_shared and events[3].m_shared);
+        ut::expect(std::ranges::is_sorted(events, {}, &spp::trace::Event::m_time));
+    };
+
+    "Containers and groups record their caller"_test = [] {
+        spp::trace::clear();
+
+        auto opt  = spp::SyncOpt<Counter>{ Counter{ 1 } };
+        auto a    = spp::Sync<Counter>{};
+        auto b    = spp::Sync<Counter>{};
+        auto line = std::source_location::current().line() + 1;
+        std::ignore = opt.get_value(&Counter::m_value);
+        spp::group(a, b).write([](Counter& x, Counter& y) { ++x.m_value, ++y.m_value; });
+
+        auto events = local_events();
+        ut::expect(events.size() == 6) << events.size();
+        if (events.size() != 6) {
+            return;
+        }
+
+        ut::expect(events[0].m_line == line);
+        ut::expect(events[3].m_line == line + 1);
+        ut::expect(events[3].m_count == 2);
+        ut::expect(std::string_view{ events[3].m_file }.ends_with("trace_test.cpp"));
+    };
+
+    "Every thread has its own track in the Chrome trace"_test = [] {
+        spp::trace::clear();
+
+        auto sync    = spp::Sync<Counter>{};
+        auto threads = std::vector<std::jthread>{};
+        for (auto t = 0; t < 4; ++t) {
+            threads.emplace_back([&] {
+                for (auto i = 0; i < 100; ++i) {
+                    sync.write([](Counter& c) { ++c.m_value; });
+                }
+            });
+        }
+        threads.clear();
+
+        auto total = std::size_t{ 0 };
+        for (const auto& [thread, events] : spp::trace::snapshot()) {
+            total += events.size();
+        }
+        ut::expect(total == 4 * 100 * 3) << total;
+
+        auto out = std::ostringstream{};
+        spp::trace::write_chrome_json(out);
+        auto json = out.str();
+
+        auto count = [&](std::string_view needle) {
+            auto n = 0;
+            for (auto pos = json.find(needle); pos != std::string::npos; pos = json.find(needle, pos + 1)) {
+                ++n;
+            }
+            return n;
+        };
+
+        ut::expect(json.starts_with("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["));
+        ut::expect(json.ends_with("]}\n"));
+        ut::expect(count("\"ph\":\"B\"") == 800);
+        ut::expect(count("\"ph\":\"E\"") == 800);
+        ut::expect(count("\"name\":\"hold trace_test.cpp:") == 400);
+    };
+
+    "The ring buffer keeps the latest events"_test = [] {
+        spp::trace::clear();
+
+        auto sync  = spp::Sync<Counter>{};
+        auto count = spp::detail::TraceBuffer::capacity / 3 + 10;
+        for (auto i = 0u; i < count; ++i) {
+            sync.write([](Counter& c) { ++c.m_value; });
+        }
+
+        auto events = local_events();
+        ut::expect(events.size() == spp::detail::TraceBuffer::capacity);
+        ut::expect(std::ranges::is_sorted(events, {}, &spp::trace::Event::m_time));
+    };
+}
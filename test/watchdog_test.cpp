@@ -0,0 +1,131 @@
+#ifndef SYNC_CPP_WATCHDOG
+#    define SYNC_CPP_WATCHDOG
+#endif
+
+#include <sync_cpp/sync.hpp>
+#include <sync_cpp/group.hpp>
+#include <sync_cpp/watchdog.hpp>
+
+#include <boost/ut.hpp>
+
+#include <chrono>
+#include <functional>
+#include <latch>
+#include <mutex>
+#include <shared_mutex>
+#include <source_location>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+struct Counter
+{
+    long m_value = 0;
+};
+
+// collects the reports of a watchdog
+class Reports
+{
+public:
+    void operator()(const spp::LongHold& hold)
+    {
+        auto lock = std::lock_guard{ m_mutex };
+        m_holds.push_back(hold);
+    }
+
+    std::vector<spp::LongHold> holds() const
+    {
+        auto lock = std::lock_guard{ m_mutex };
+        return m_holds;
+    }
+
+private:
+    mutable std::mutex         m_mutex;
+    std::vector<spp::LongHold> m_holds;
+};
+
+int main()
+{
+    namespace ut = boost::ut;
+    using namespace ut::literals;
+
+    static_assert(spp::Watchdog::enabled);
+
+    "A hold past the budget is reported once, while held"_test = [] {
+        auto reports  = Reports{};
+        auto watchdog = spp::Watchdog{ 200ms, std::ref(reports), 1h };
+        auto sync     = spp::Sync<Counter>{};
+        auto held     = std::latch{ 1 };
+        auto release  = std::latch{ 1 };
+
+        auto line   = std::source_location::current().line() + 2;
+        auto holder = std::jthread{ [&] {
+            sync.write([&](Counter&) { held.count_down(), release.wait(); });
+        } };
+        held.wait();
+
+        watchdog.scan();
+        ut::expect(reports.holds().empty());    // unless this thread was descheduled for the whole budget
+
+        std::this_thread::sleep_for(250ms);
+        watchdog.scan();
+        watchdog.scan();
+
+        auto holds = reports.holds();
+        ut::expect(holds.size() == 1);
+        if (holds.size() == 1) {
+            ut::expect(holds[0].m_mutex == &sync.mutex());
+            ut::expect(holds[0].m_thread_id == holder.get_id());
+            ut::expect(holds[0].m_line == line);
+            ut::expect(std::string_view{ holds[0].m_file }.ends_with("watchdog_test.cpp"));
+            ut::expect(holds[0].m_held >= 250ms and holds[0].m_budget == 200ms);
+            ut::expect(not holds[0].m_shared);
+        }
+
+        release.count_down();
+        holder.join();
+        watchdog.scan();
+        ut::expect(reports.holds().size() == 1);
+    };
+
+    "Objects can have their own budget"_test = [] {
+        auto reports  = Reports{};
+        auto watchdog = spp::Watchdog{ 1h, std::ref(reports), 1h };
+        auto tight    = spp::Sync<Counter>{};
+        auto loose    = spp::Sync<Counter>{};
+        watchdog.set_budget(tight, 20ms);
+
+        spp::group(tight, loose).write([&](Counter&, Counter&) {
+            std::this_thread::sleep_for(30ms);
+            watchdog.scan();
+        });
+        ut::expect(reports.holds().size() == 1);    // a group is held under its first object
+
+        watchdog.reset_budget(tight);
+        tight.write([&](Counter&) {
+            std::this_thread::sleep_for(30ms);
+            watchdog.scan();
+        });
+        ut::expect(reports.holds().size() == 1);
+    };
+
+    "The background thread scans periodically"_test = [] {
+        auto reports  = Reports{};
+        auto watchdog = spp::Watchdog{ 2ms, std::ref(reports), 1ms };
+        auto sync     = spp::Sync<Counter, std::shared_mutex>{};
+
+        std::ignore = sync.read([&](const Counter& c) {
+            for (auto i = 0; i < 1'000 and reports.holds().empty(); ++i) {
+                std::this_thread::sleep_for(1ms);
+            }
+            return c.m_value;
+        });
+
+        auto holds = reports.holds();
+        ut::expect(holds.size() == 1);
+        ut::expect(not holds.empty() and holds[0].m_shared);
+    };
+}